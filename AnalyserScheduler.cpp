@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    AnalyserScheduler.cpp
+    Created: 19 Oct 2026 9:43:53am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "AnalyserScheduler.h"
+
+//==============================================================================
+AnalyserScheduler::AnalyserScheduler()
+{
+}
+
+AnalyserScheduler::~AnalyserScheduler()
+{
+    stopTimer();
+}
+
+void AnalyserScheduler::addClient (Client* client)
+{
+    jassert (client != nullptr);
+    clients.addIfNotAlreadyThere (client);
+    silentTicks = 0;
+    setRate (activeRateHz);
+}
+
+void AnalyserScheduler::removeClient (Client* client)
+{
+    clients.removeFirstMatchingValue (client);
+
+    if (clients.isEmpty())
+        setRate (0);
+}
+
+void AnalyserScheduler::timerCallback()
+{
+    bool anyShowing = false;
+    bool anySignal = false;
+
+    for (auto* client : clients)
+    {
+        auto& component = client->getAnalyserComponent();
+
+        if (! component.isShowing())
+            continue;
+
+        anyShowing = true;
+
+        // Nothing new published means nothing to repaint
+        if (client->pullNewFrame())
+        {
+            auto dirty = client->getDirtyArea();
+
+            if (! dirty.isEmpty())
+                component.repaint (dirty);
+
+            anySignal = anySignal || client->isSignalPresent();
+        }
+    }
+
+    // Give the signal half a second of silence before slowing down, so short gaps don't stutter
+    silentTicks = anySignal ? 0 : silentTicks + 1;
+
+    if (! anyShowing)
+        setRate (hiddenRateHz);
+    else if (silentTicks > currentRateHz / 2)
+        setRate (silentRateHz);
+    else
+        setRate (activeRateHz);
+}
+
+void AnalyserScheduler::setRate (int newRateHz)
+{
+    if (newRateHz == currentRateHz)
+        return;
+
+    currentRateHz = newRateHz;
+
+    if (newRateHz > 0)
+        startTimerHz (newRateHz);
+    else
+        stopTimer();
+}
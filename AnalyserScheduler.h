@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+    AnalyserScheduler.h
+    Created: 19 Oct 2026 9:43:53am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Drives the repaints of every analyzer view in one editor from a single timer.
+
+    Views are only repainted when they report a newly published frame, and only
+    over the area they say is dirty. The timer drops to a low rate while the
+    signal is silent and to a heartbeat while no view is showing, so idle
+    editors cost next to nothing.
+*/
+class AnalyserScheduler  : private juce::Timer
+{
+public:
+    struct Client
+    {
+        virtual ~Client() = default;
+
+        /** Swaps in any newly published data. Returns false if nothing changed. */
+        virtual bool pullNewFrame() = 0;
+
+        virtual juce::Component& getAnalyserComponent() = 0;
+
+        /** The part of the component that needs repainting after a new frame. */
+        virtual juce::Rectangle<int> getDirtyArea()         { return getAnalyserComponent().getLocalBounds(); }
+
+        /** Returning false lets the scheduler slow down. */
+        virtual bool isSignalPresent() const                { return true; }
+    };
+
+    AnalyserScheduler();
+    ~AnalyserScheduler() override;
+
+    void addClient (Client*);
+    void removeClient (Client*);
+
+    static constexpr int activeRateHz = 60;
+    static constexpr int silentRateHz = 10;
+    static constexpr int hiddenRateHz = 2;
+
+private:
+    void timerCallback() override;
+    void setRate (int newRateHz);
+
+    juce::Array<Client*> clients;
+    int currentRateHz = 0;
+    int silentTicks = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AnalyserScheduler)
+};
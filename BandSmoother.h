@@ -0,0 +1,84 @@
+/*
+  ==============================================================================
+
+    BandSmoother.h
+    Created: 19 Oct 2026 9:51:51am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/** One EQ band's settings, in plain units. */
+struct BandSettings
+{
+    float frequency = 1000.0f;
+    float gain = 0.0f;      // decibels
+    float Q = 1.0f;
+    int type = 5;           // peak, matching the type menu order
+
+    bool operator== (const BandSettings& other) const noexcept
+    {
+        return frequency == other.frequency && gain == other.gain && Q == other.Q && type == other.type;
+    }
+
+    bool operator!= (const BandSettings& other) const noexcept      { return ! operator== (other); }
+};
+
+//==============================================================================
+/**
+    Glides a band towards its target settings so that coefficient changes
+    don't click. Frequency and Q move geometrically, gain linearly in dB.
+    The audio thread advances it once per sub-block and redesigns the band's
+    coefficients only while it is still moving.
+*/
+class BandSmoother
+{
+public:
+    void reset (double sampleRate, double rampSeconds, const BandSettings& initial)
+    {
+        frequency.reset (sampleRate, rampSeconds);
+        Q.reset (sampleRate, rampSeconds);
+        gain.reset (sampleRate, rampSeconds);
+
+        frequency.setCurrentAndTargetValue (initial.frequency);
+        Q.setCurrentAndTargetValue (initial.Q);
+        gain.setCurrentAndTargetValue (initial.gain);
+        type = initial.type;
+        typeChanged = true;
+    }
+
+    void setTarget (const BandSettings& target) noexcept
+    {
+        frequency.setTargetValue (target.frequency);
+        Q.setTargetValue (target.Q);
+        gain.setTargetValue (target.gain);
+
+        // The filter shape can't be interpolated, so it switches straight away
+        typeChanged = typeChanged || target.type != type;
+        type = target.type;
+    }
+
+    /** True if the coefficients need redesigning for the next sub-block. */
+    bool needsUpdate() const noexcept
+    {
+        return typeChanged || frequency.isSmoothing() || Q.isSmoothing() || gain.isSmoothing();
+    }
+
+    /** Moves on by one sub-block and returns the settings to design for it. */
+    BandSettings advance (int numSamples) noexcept
+    {
+        typeChanged = false;
+        return { frequency.skip (numSamples), gain.skip (numSamples), Q.skip (numSamples), type };
+    }
+
+private:
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> frequency, Q;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> gain;
+    int type = 5;
+    bool typeChanged = true;
+};
@@ -0,0 +1,158 @@
+/*
+  ==============================================================================
+
+    BatchRender.cpp
+    Created: 19 Oct 2026 9:58:53am
+    Author:  jarre
+
+    Console target: applies a JarEQ preset to many audio files at once.
+
+    Usage: BatchRender --preset <file> --out <dir> [--format wav|flac|aiff]
+                       [--block <samples>] [--threads <n>]
+                       [--chunk <seconds> [--tolerance <error>] [--verify]]
+                       <files or folders...>
+
+    --chunk splits each file across all threads instead of rendering one file
+    per thread, which is what a handful of multi-hour files need. --verify also
+    renders sequentially and fails any file that differs by more than the
+    tolerance (default 1e-6 of full scale). It first checks that a flat preset
+    at full mix passes noise through unchanged, and stops if it doesn't.
+
+    Needs no audio device or display, so it runs on headless build boxes.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "OfflineRenderer.h"
+
+namespace
+{
+    struct ConsoleProgress  : public OfflineRenderer::Listener
+    {
+        explicit ConsoleProgress (const juce::Array<juce::File>& files) : inputs (files) {}
+
+        void fileProgress (int fileIndex, float proportion) override
+        {
+            // Keep the output readable with many files in flight: quarters only
+            const auto quarter = (int) (proportion * 4.0f);
+
+            if (quarter > 0 && quarter < 4)
+                print (inputs[fileIndex].getFileName() + "  " + juce::String (quarter * 25) + "%");
+        }
+
+        void fileFinished (int, const OfflineRenderer::Result& result) override
+        {
+            auto done = ++numFinished;
+            auto line = "[" + juce::String (done) + "/" + juce::String (inputs.size()) + "] " + result.input.getFileName();
+
+            if (result.succeeded())
+                line << "  " << juce::String (result.audioSeconds / juce::jmax (1.0e-9, result.wallSeconds), 1) << "x realtime";
+            else
+                line << "  FAILED: " << result.error;
+
+            if (result.maxChunkError >= 0.0)
+                line << "  max error vs sequential " << juce::String (result.maxChunkError, 10);
+
+            print (line);
+        }
+
+        void print (const juce::String& line)
+        {
+            const juce::ScopedLock sl (lock);
+            std::cout << line << std::endl;
+        }
+
+        const juce::Array<juce::File>& inputs;
+        std::atomic<int> numFinished { 0 };
+        juce::CriticalSection lock;
+    };
+
+    juce::Array<juce::File> collectInputs (const juce::StringArray& paths, juce::AudioFormatManager& formats)
+    {
+        juce::Array<juce::File> files;
+        const auto wildcard = formats.getWildcardForAllFormats();
+
+        for (auto& path : paths)
+        {
+            auto file = juce::File::getCurrentWorkingDirectory().getChildFile (path);
+
+            if (file.isDirectory())
+                files.addArray (file.findChildFiles (juce::File::findFiles, true, wildcard));
+            else if (file.existsAsFile())
+                files.add (file);
+        }
+
+        return files;
+    }
+
+    int fail (const juce::String& message)
+    {
+        std::cerr << message << std::endl;
+        return 1;
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    juce::ArgumentList args (argc, argv);
+
+    OfflineRenderer::Settings settings;
+    juce::StringArray paths;
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        auto& arg = args[i];
+        auto next = [&] { return i + 1 < args.size() ? args[++i].text : juce::String(); };
+
+        if      (arg == "--preset")     settings.presetFile = juce::File::getCurrentWorkingDirectory().getChildFile (next());
+        else if (arg == "--out")        settings.outputDirectory = juce::File::getCurrentWorkingDirectory().getChildFile (next());
+        else if (arg == "--format")     settings.outputExtension = "." + next().trimCharactersAtStart (".").toLowerCase();
+        else if (arg == "--block")      settings.blockSize = juce::jlimit (16, 65536, next().getIntValue());
+        else if (arg == "--threads")    settings.numThreads = juce::jmax (0, next().getIntValue());
+        else if (arg == "--chunk")      settings.chunkSeconds = juce::jmax (0.0, next().getDoubleValue());
+        else if (arg == "--tolerance")  settings.chunkTolerance = juce::jmax (1.0e-12, next().getDoubleValue());
+        else if (arg == "--verify")     settings.verifyChunks = true;
+        else                            paths.add (arg.text);
+    }
+
+    if (settings.presetFile == juce::File() || settings.outputDirectory == juce::File() || paths.isEmpty())
+        return fail ("Usage: BatchRender --preset <file> --out <dir> [--format wav|flac|aiff] [--block n] [--threads n] [--chunk s [--tolerance e] [--verify]] <files or folders...>");
+
+    OfflineRenderer renderer (settings);
+
+    if (auto loaded = renderer.loadPreset(); loaded.failed())
+        return fail (loaded.getErrorMessage());
+
+    if (settings.verifyChunks)
+        if (auto transparent = renderer.checkFlatPresetIsTransparent (48000.0); transparent.failed())
+            return fail (transparent.getErrorMessage());
+
+    auto inputs = collectInputs (paths, renderer.getFormatManager());
+
+    if (inputs.isEmpty())
+        return fail ("No audio files found");
+
+    ConsoleProgress progress (inputs);
+    const auto startTicks = juce::Time::getHighResolutionTicks();
+
+    auto results = renderer.renderAll (inputs, &progress);
+
+    const auto wallSeconds = juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - startTicks);
+    double audioSeconds = 0.0;
+    int numFailed = 0;
+
+    for (auto& result : results)
+    {
+        audioSeconds += result.audioSeconds;
+        numFailed += result.succeeded() ? 0 : 1;
+    }
+
+    std::cout << std::endl
+              << (int) results.size() - numFailed << " rendered, " << numFailed << " failed" << std::endl
+              << juce::String (audioSeconds, 1) << " s of audio in " << juce::String (wallSeconds, 2) << " s: "
+              << juce::String (audioSeconds / juce::jmax (1.0e-9, wallSeconds), 1) << "x realtime" << std::endl;
+
+    return numFailed == 0 ? 0 : 1;
+}
@@ -0,0 +1,57 @@
+/*
+  ==============================================================================
+
+    FilterBank.cpp
+    Created: 19 Oct 2026 9:54:36am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "FilterBank.h"
+
+//==============================================================================
+void FilterBank::prepare (int numBands, int numChannels, double sampleRate)
+{
+    if (dsp == nullptr || numBands != bands || numChannels != channels || sampleRate != rate)
+    {
+        dsp.reset (jareq_dsp_create (numBands, numChannels, sampleRate));
+        jassert (dsp != nullptr);
+
+        bands = numBands;
+        channels = numChannels;
+        rate = sampleRate;
+    }
+
+    reset();
+}
+
+void FilterBank::reset() noexcept
+{
+    jareq_dsp_reset (dsp.get());
+}
+
+void FilterBank::setPeak (int band, const PeakDesignTable& table, float frequency, float Q, float gainDecibels) noexcept
+{
+    jassert (juce::isPositiveAndBelow (band, bands));
+
+    // The table gives the library's own design without any trig on the audio thread
+    float c[5];
+    table.designPeak (frequency, Q, gainDecibels, c);
+    jareq_dsp_set_band_coefficients (dsp.get(), band, c);
+}
+
+void FilterBank::process (float* const* channelData, int numChannels, int startSample, int numSamples) noexcept
+{
+    jareq_dsp_process_planar (dsp.get(), channelData, numChannels, startSample, numSamples);
+}
+
+int FilterBank::getDecaySamples (double tolerance) const noexcept
+{
+    return jareq_dsp_get_decay_samples (dsp.get(), tolerance);
+}
+
+size_t FilterBank::getMemoryUsage() const noexcept
+{
+    return jareq_dsp_get_memory_usage (dsp.get());
+}
@@ -0,0 +1,57 @@
+/*
+  ==============================================================================
+
+    FilterBank.h
+    Created: 19 Oct 2026 9:54:36am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SharedResources.h"
+#include "JarEQDsp.h"
+
+//==============================================================================
+/**
+    The plugin's view of the JarEQDsp library: every band's coefficients and
+    per-channel state in one aligned allocation, owned here.
+
+    The instance is only recreated when the band count, channel count or
+    sample rate changes, so an instance's DSP state is a single small
+    allocation made in prepareToPlay().
+*/
+class FilterBank
+{
+public:
+    /** Allocates for the given layout and clears the state. */
+    void prepare (int numBands, int numChannels, double sampleRate);
+
+    /** Clears the filter state without touching the coefficients. */
+    void reset() noexcept;
+
+    /** Designs a peak band from the shared table for the current sample rate. */
+    void setPeak (int band, const PeakDesignTable&, float frequency, float Q, float gainDecibels) noexcept;
+
+    /** Runs samples [startSample, startSample + numSamples) of each channel through every band in turn. */
+    void process (float* const* channels, int numChannels, int startSample, int numSamples) noexcept;
+
+    /** Samples until the state left by any input has decayed below tolerance
+        (relative to the state's size), or INT_MAX if a band doesn't decay.
+    */
+    int getDecaySamples (double tolerance) const noexcept;
+
+    size_t getMemoryUsage() const noexcept;
+
+private:
+    struct Deleter
+    {
+        void operator() (JarEQDsp* d) const noexcept    { jareq_dsp_destroy (d); }
+    };
+
+    std::unique_ptr<JarEQDsp, Deleter> dsp;
+    int bands = 0, channels = 0;
+    double rate = 0.0;
+};
@@ -0,0 +1,46 @@
+/*
+  ==============================================================================
+
+    FrequencyMapping.h
+    Created: 19 Oct 2026 9:41:13am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/** Log-frequency axis shared by the spectrum and spectrogram views. */
+struct LogFrequencyMap
+{
+    static constexpr float minFrequency = 20.0f;
+    static constexpr float maxFrequency = 20000.0f;
+
+    /** Returns 0..1 along the axis for a frequency in Hz. */
+    static float frequencyToProportion (float frequency)
+    {
+        return juce::mapFromLog10 (juce::jlimit (minFrequency, maxFrequency, frequency), minFrequency, maxFrequency);
+    }
+
+    /** Returns the frequency in Hz at 0..1 along the axis. */
+    static float proportionToFrequency (float proportion)
+    {
+        return juce::mapToLog10 (juce::jlimit (0.0f, 1.0f, proportion), minFrequency, maxFrequency);
+    }
+
+    /** Returns the (fractional) FFT bin index for a frequency. */
+    static float frequencyToBin (float frequency, int fftSize, double sampleRate)
+    {
+        return (float) (frequency * fftSize / sampleRate);
+    }
+
+    /** Returns the axis position of an FFT bin, in the range [start, end]. */
+    static float binToPosition (int bin, int fftSize, double sampleRate, float start, float end)
+    {
+        auto frequency = (float) (bin * sampleRate / fftSize);
+        return juce::jmap (frequencyToProportion (frequency), start, end);
+    }
+};
@@ -0,0 +1,578 @@
+/*
+  ==============================================================================
+
+    GoldenOutputCheck.cpp
+    Created: 19 Oct 2026 10:13:32am
+    Author:  jarre
+
+    Console target that checks every engine path against a double-precision
+    reference over a corpus of filter settings.
+
+    Usage: GoldenOutputCheck [--rates 44100,96000,384000] [--path <name>] [--verbose]
+
+    The corpus covers all 8 types from FilterChain::setType (the editor's type
+    list) at 20 Hz, 1 kHz and the top band frequency, at Q 0.1, 0.7 and 10,
+    and at -24 and +24 dB for the types that have a gain. For each case the
+    reference is the same design worked out and run in double precision, on
+    one second of seeded noise and on an impulse. Each path reports:
+
+        max / RMS error     time-domain difference from the reference output
+        response deviation  largest dB difference of the impulse responses'
+                            spectra, at 48 log-spaced frequencies
+
+    A float biquad can't match the reference exactly. Each case therefore also
+    renders a float baseline, the reference coefficients rounded to float and
+    run in float, and a path passes if every metric is under its absolute
+    floor or within its slack factor of the baseline.
+
+    Near DC at high sample rates a single ulp in a float coefficient moves
+    the response by dBs (30 dB at 20 Hz, 384 kHz), so no float biquad can be
+    held to these designs. Cases whose response moves by more than 0.1 dB
+    for a one-ulp nudge are reported as ill-conditioned but not gated.
+    Exits with 1 if any path fails a gate.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+#include "Constants.h"
+#include "JarEQDsp.h"
+#include "MultiStreamEQ.h"
+
+namespace
+{
+    const juce::StringArray typeNames { "Low Pass", "High Pass", "Band Pass", "Notch", "All Pass", "Peak", "Low Shelf", "High Shelf" };
+
+    enum Type { lowPass, highPass, bandPass, notch, allPass, peak, lowShelf, highShelf };
+
+    struct Case
+    {
+        int type;
+        double rate, frequency, Q, gainDb;
+
+        juce::String getDescription() const
+        {
+            return typeNames[type] + " " + juce::String (frequency, 0) + " Hz Q " + juce::String (Q, 1)
+                    + (type >= peak ? " " + juce::String (gainDb, 0) + " dB" : juce::String())
+                    + " @ " + juce::String (rate, 0);
+        }
+    };
+
+    struct Metrics
+    {
+        double maxError = 0.0, rmsError = 0.0, responseDb = 0.0;
+    };
+
+    struct Gate
+    {
+        double maxError, rmsError, responseDb;      // absolute floors
+        double slack;                               // allowed factor over the float baseline
+    };
+
+    constexpr double illConditionedDb = 0.1;
+
+    void setPlainValue (JarEQAudioProcessor& processor, juce::uint16 stableID, float value)
+    {
+        auto* parameter = processor.getParameterByStableID (stableID);
+        jassert (parameter != nullptr);
+        parameter->setValueNotifyingHost (parameter->convertTo0to1 (value));
+    }
+
+    struct Path
+    {
+        juce::String name;
+        Gate gate;
+        std::function<bool (const Case&)> supports;
+        std::function<void (const Case&, std::vector<float>&)> render;   // in place, mono
+    };
+
+    using Biquad = std::array<double, 5>;   // normalised b0, b1, b2, a1, a2
+
+    //==============================================================================
+    /** The IIR::Coefficients designs used by FilterChain, evaluated in double. */
+    Biquad designReference (const Case& c)
+    {
+        const auto pi = juce::MathConstants<double>::pi;
+        double b0, b1, b2, a0, a1, a2;
+
+        if (c.type <= allPass)
+        {
+            const auto invQ = 1.0 / c.Q;
+            const auto t = std::tan (pi * c.frequency / c.rate);
+            const auto n = c.type == highPass ? t : 1.0 / t;
+            const auto nSquared = n * n;
+
+            a0 = 1.0 + invQ * n + nSquared;
+            a1 = 2.0 * (c.type == highPass ? nSquared - 1.0 : 1.0 - nSquared);
+            a2 = 1.0 - invQ * n + nSquared;
+
+            switch (c.type)
+            {
+                case lowPass:   b0 = 1.0;             b1 = 2.0;                     b2 = 1.0;             break;
+                case highPass:  b0 = 1.0;             b1 = -2.0;                    b2 = 1.0;             break;
+                case bandPass:  b0 = n * invQ;        b1 = 0.0;                     b2 = -n * invQ;       break;
+                case notch:     b0 = 1.0 + nSquared;  b1 = 2.0 * (1.0 - nSquared);  b2 = 1.0 + nSquared;  break;
+                default:        b0 = a2;              b1 = a1;                      b2 = a0;              break;
+            }
+        }
+        else
+        {
+            const auto A = std::sqrt (juce::jmax (0.0, std::pow (10.0, c.gainDb * 0.05)));
+            const auto omega = 2.0 * pi * juce::jmax (c.frequency, 2.0) / c.rate;
+            const auto cosOmega = std::cos (omega);
+
+            if (c.type == peak)
+            {
+                const auto alpha = std::sin (omega) / (2.0 * c.Q);
+                b0 = 1.0 + alpha * A;  b1 = -2.0 * cosOmega;  b2 = 1.0 - alpha * A;
+                a0 = 1.0 + alpha / A;  a1 = -2.0 * cosOmega;  a2 = 1.0 - alpha / A;
+            }
+            else
+            {
+                const auto beta = std::sin (omega) * std::sqrt (A) / c.Q;
+                const auto aMinus1 = A - 1.0, aPlus1 = A + 1.0, aMinus1TimesCos = aMinus1 * cosOmega;
+                const auto sign = c.type == lowShelf ? 1.0 : -1.0;
+
+                b0 = A * (aPlus1 - sign * aMinus1TimesCos + beta);
+                b1 = sign * 2.0 * A * (aMinus1 - sign * aPlus1 * cosOmega);
+                b2 = A * (aPlus1 - sign * aMinus1TimesCos - beta);
+                a0 = aPlus1 + sign * aMinus1TimesCos + beta;
+                a1 = -sign * 2.0 * (aMinus1 + sign * aPlus1 * cosOmega);
+                a2 = aPlus1 + sign * aMinus1TimesCos - beta;
+            }
+        }
+
+        return { b0 / a0, b1 / a0, b2 / a0, a1 / a0, a2 / a0 };
+    }
+
+    template <typename Sample>
+    void runBiquad (const Biquad& c, Sample* samples, size_t num)
+    {
+        const Sample b0 = (Sample) c[0], b1 = (Sample) c[1], b2 = (Sample) c[2], a1 = (Sample) c[3], a2 = (Sample) c[4];
+        Sample z1 = 0, z2 = 0;
+
+        for (size_t i = 0; i < num; ++i)
+        {
+            const auto in = samples[i];
+            const auto out = b0 * in + z1;
+            z1 = b1 * in - a1 * out + z2;
+            z2 = b2 * in - a2 * out;
+            samples[i] = out;
+        }
+    }
+
+    /** Long enough for the reference's impulse response to die away, within reason. */
+    size_t getImpulseLength (const Biquad& c)
+    {
+        const auto discriminant = c[3] * c[3] - 4.0 * c[4];
+        const auto radius = discriminant < 0.0 ? std::sqrt (c[4]) : 0.5 * (std::abs (c[3]) + std::sqrt (discriminant));
+        const auto length = radius > 0.0 && radius < 1.0 ? std::log (1.0e-9) / std::log (radius) : 0.0;
+
+        return (size_t) juce::jlimit (4096.0, (double) (1 << 17), std::ceil (length));
+    }
+
+    double getFrequencyPoint (int k, double rate)
+    {
+        return 10.0 * std::pow (0.49 * rate / 10.0, k / 47.0);
+    }
+
+    template <typename Coefficient>
+    double getMagnitudeDb (const Coefficient* c, double frequency, double rate)
+    {
+        const auto z = std::polar (1.0, -juce::MathConstants<double>::twoPi * frequency / rate);
+        const auto numerator = (double) c[0] + z * ((double) c[1] + z * (double) c[2]);
+        const auto denominator = 1.0 + z * ((double) c[3] + z * (double) c[4]);
+
+        return 20.0 * std::log10 (std::abs (numerator / denominator) + 1.0e-30);
+    }
+
+    /** How far the response moves, in dB, when the float coefficients are nudged by an ulp. */
+    double getSensitivity (const Biquad& c, double rate)
+    {
+        float rounded[5];
+
+        for (size_t i = 0; i < 5; ++i)
+            rounded[i] = (float) c[i];
+
+        double worst = 0.0;
+
+        // Every combination of each coefficient nudged down, kept, or nudged up
+        for (int combination = 1; combination < 243; ++combination)
+        {
+            float nudged[5];
+
+            for (int i = 0, digits = combination; i < 5; ++i, digits /= 3)
+                nudged[i] = digits % 3 == 0 ? rounded[i]
+                                            : std::nextafter (rounded[i], digits % 3 == 1 ? 1.0e9f : -1.0e9f);
+
+            for (int k = 0; k < 48; ++k)
+            {
+                const auto frequency = getFrequencyPoint (k, rate);
+                worst = juce::jmax (worst, std::abs (getMagnitudeDb (nudged, frequency, rate) - getMagnitudeDb (rounded, frequency, rate)));
+            }
+        }
+
+        return worst;
+    }
+
+    /** The impulse response's spectrum in dB at 48 log-spaced frequencies, floored at -100 dB. */
+    template <typename Sample>
+    std::vector<double> getSpectrum (const std::vector<Sample>& impulseResponse, double rate)
+    {
+        std::vector<double> decibels;
+
+        for (int k = 0; k < 48; ++k)
+        {
+            const auto frequency = getFrequencyPoint (k, rate);
+            const auto step = std::polar (1.0, -juce::MathConstants<double>::twoPi * frequency / rate);
+            std::complex<double> phasor (1.0), sum;
+
+            for (auto h : impulseResponse)
+            {
+                sum += (double) h * phasor;
+                phasor *= step;
+            }
+
+            decibels.push_back (juce::jmax (-100.0, 20.0 * std::log10 (std::abs (sum) + 1.0e-30)));
+        }
+
+        return decibels;
+    }
+
+    //==============================================================================
+    struct Reference
+    {
+        std::vector<double> input, output, impulseSpectrum;
+        size_t impulseLength;
+    };
+
+    template <typename Sample>
+    Metrics compare (const Reference& reference, const std::vector<Sample>& output, const std::vector<Sample>& impulseResponse, double rate)
+    {
+        Metrics m;
+        double sumOfSquares = 0.0;
+
+        for (size_t i = 0; i < output.size(); ++i)
+        {
+            const auto error = std::abs ((double) output[i] - reference.output[i]);
+            m.maxError = juce::jmax (m.maxError, error);
+            sumOfSquares += error * error;
+        }
+
+        m.rmsError = std::sqrt (sumOfSquares / (double) juce::jmax ((size_t) 1, output.size()));
+
+        const auto spectrum = getSpectrum (impulseResponse, rate);
+
+        for (size_t k = 0; k < spectrum.size(); ++k)
+            m.responseDb = juce::jmax (m.responseDb, std::abs (spectrum[k] - reference.impulseSpectrum[k]));
+
+        return m;
+    }
+
+    //==============================================================================
+    juce::dsp::IIR::Coefficients<float>::Ptr makeJuceCoefficients (const Case& c)
+    {
+        using Coefficients = juce::dsp::IIR::Coefficients<float>;
+        const auto f = (float) c.frequency, q = (float) c.Q;
+        const auto gain = juce::Decibels::decibelsToGain ((float) c.gainDb);
+
+        switch (c.type)
+        {
+            case lowPass:   return Coefficients::makeLowPass (c.rate, f, q);
+            case highPass:  return Coefficients::makeHighPass (c.rate, f, q);
+            case bandPass:  return Coefficients::makeBandPass (c.rate, f, q);
+            case notch:     return Coefficients::makeNotch (c.rate, f, q);
+            case allPass:   return Coefficients::makeAllPass (c.rate, f, q);
+            case peak:      return Coefficients::makePeakFilter (c.rate, f, q, gain);
+            case lowShelf:  return Coefficients::makeLowShelf (c.rate, f, q, gain);
+            default:        return Coefficients::makeHighShelf (c.rate, f, q, gain);
+        }
+    }
+
+    std::vector<Path> createPaths()
+    {
+        // Only the peak design is implemented outside JUCE's IIR classes
+        auto peakOnly = [] (const Case& c) { return c.type == peak; };
+        auto anyType  = [] (const Case&)   { return true; };
+
+        // Float designs (JUCE computes its coefficients in float) get more slack
+        // A one-ulp difference in a coefficient alone can cost several times the baseline's error
+        const Gate floatDesign  { 1.0e-5, 1.0e-6, 0.01, 64.0 };
+        const Gate doubleDesign { 1.0e-5, 1.0e-6, 0.01, 8.0 };
+
+        std::vector<Path> paths;
+
+        paths.push_back ({ "juce-iir", floatDesign, anyType, [] (const Case& c, std::vector<float>& samples)
+        {
+            juce::dsp::IIR::Filter<float> filter (makeJuceCoefficients (c));
+            filter.reset();
+
+            for (auto& sample : samples)
+                sample = filter.processSample (sample);
+        }});
+
+        paths.push_back ({ "design-table", doubleDesign, peakOnly, [] (const Case& c, std::vector<float>& samples)
+        {
+            juce::SharedResourcePointer<SharedCoefficientTables> tables;
+            auto table = tables->getPeakTable (c.rate);
+
+            FilterBank bank;
+            bank.prepare (1, 1, c.rate);
+            bank.setPeak (0, *table, (float) c.frequency, (float) c.Q, (float) c.gainDb);
+
+            auto* channel = samples.data();
+            bank.process (&channel, 1, 0, (int) samples.size());
+        }});
+
+        paths.push_back ({ "library", doubleDesign, peakOnly, [] (const Case& c, std::vector<float>& samples)
+        {
+            auto* dsp = jareq_dsp_create (1, 1, c.rate);
+            jareq_dsp_set_band (dsp, 0, (float) c.frequency, (float) c.Q, (float) c.gainDb);
+
+            auto* channel = samples.data();
+            jareq_dsp_process_planar (dsp, &channel, 1, 0, (int) samples.size());
+            jareq_dsp_destroy (dsp);
+        }});
+
+        paths.push_back ({ "library-interleaved", doubleDesign, peakOnly, [] (const Case& c, std::vector<float>& samples)
+        {
+            auto* dsp = jareq_dsp_create (1, 2, c.rate);
+            jareq_dsp_set_band (dsp, 0, (float) c.frequency, (float) c.Q, (float) c.gainDb);
+
+            // Both channels carry the signal; the second one is what's checked, so the stride is exercised
+            std::vector<float> interleaved (samples.size() * 2);
+
+            for (size_t i = 0; i < samples.size(); ++i)
+                interleaved[2 * i] = interleaved[2 * i + 1] = samples[i];
+
+            jareq_dsp_process_interleaved (dsp, interleaved.data(), 2, (int) samples.size());
+            jareq_dsp_destroy (dsp);
+
+            for (size_t i = 0; i < samples.size(); ++i)
+                samples[i] = interleaved[2 * i + 1];
+        }});
+
+        paths.push_back ({ "multistream", doubleDesign, peakOnly, [] (const Case& c, std::vector<float>& samples)
+        {
+            MultiStreamEQ engine (c.rate, 1);
+
+            // A few neighbours in the same group, so the checked stream isn't alone in its registers
+            std::vector<std::vector<float>> others (3, samples);
+            std::vector<float*> buffers;
+
+            for (int i = 0; i < 4; ++i)
+            {
+                const auto id = engine.addStream();
+                engine.setBand (id, 0, (float) c.frequency, (float) c.Q, (float) c.gainDb);
+                buffers.resize ((size_t) engine.getStreamIDLimit());
+                buffers[(size_t) id] = i == 2 ? samples.data() : others[(size_t) juce::jmin (i, 2)].data();
+            }
+
+            for (size_t start = 0; start < samples.size(); start += 4096)
+            {
+                const auto num = (int) juce::jmin ((size_t) 4096, samples.size() - start);
+                std::vector<float*> offsets;
+
+                for (auto* buffer : buffers)
+                    offsets.push_back (buffer + start);
+
+                engine.process (offsets.data(), num);
+            }
+        }});
+
+        // Both channels carry the same input and each must match the reference on its own,
+        // so a mix or routing fault on either side fails the check
+        for (int outputChannel = 0; outputChannel < 2; ++outputChannel)
+        {
+            paths.push_back ({ outputChannel == 0 ? "processor left" : "processor right", doubleDesign, peakOnly,
+                               [outputChannel] (const Case& c, std::vector<float>& samples)
+            {
+                constexpr int blockSize = 512;
+                JarEQAudioProcessor processor;
+                processor.setPlayConfigDetails (2, 2, c.rate, blockSize);
+
+                // One band under test, the rest flat, all wet
+                for (int band = 0; band < maxNumFilterBands; ++band)
+                    setPlainValue (processor, StableParameterID::forBand (band, StableParameterID::gain), 0.0f);
+
+                setPlainValue (processor, StableParameterID::forBand (0, StableParameterID::frequency), (float) c.frequency);
+                setPlainValue (processor, StableParameterID::forBand (0, StableParameterID::Q), (float) c.Q);
+                setPlainValue (processor, StableParameterID::forBand (0, StableParameterID::gain), (float) c.gainDb);
+                setPlainValue (processor, StableParameterID::mix, 1.0f);
+
+                processor.prepareToPlay (c.rate, blockSize);
+
+                juce::AudioBuffer<float> block (2, blockSize);
+                juce::MidiBuffer midi;
+
+                for (size_t start = 0; start < samples.size(); start += blockSize)
+                {
+                    const auto num = (int) juce::jmin ((size_t) blockSize, samples.size() - start);
+                    juce::AudioBuffer<float> view (block.getArrayOfWritePointers(), 2, 0, num);
+
+                    view.copyFrom (0, 0, samples.data() + start, num);
+                    view.copyFrom (1, 0, samples.data() + start, num);
+                    processor.processBlock (view, midi);
+                    std::copy (view.getReadPointer (outputChannel), view.getReadPointer (outputChannel) + num, samples.data() + start);
+                }
+
+                processor.releaseResources();
+            }});
+        }
+
+        return paths;
+    }
+
+    std::vector<Case> createCorpus (const juce::Array<double>& rates)
+    {
+        std::vector<Case> corpus;
+
+        for (auto rate : rates)
+            for (int type = 0; type < typeNames.size(); ++type)
+                for (auto frequency : { 20.0, 1000.0, juce::jmin (20000.0, 0.45 * rate) })
+                    for (auto Q : { 0.1, 0.7, 10.0 })
+                        for (auto gainDb : type >= peak ? std::vector<double> { -24.0, 24.0 } : std::vector<double> { 0.0 })
+                            corpus.push_back ({ type, rate, frequency, Q, gainDb });
+
+        return corpus;
+    }
+
+    juce::String format (const Metrics& m)
+    {
+        return juce::String (m.maxError, 8).paddedLeft (' ', 14) + juce::String (m.rmsError, 9).paddedLeft (' ', 14)
+                + juce::String (m.responseDb, 4).paddedLeft (' ', 10) + " dB";
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    juce::ArgumentList args (argc, argv);
+
+    juce::Array<double> rates { 44100.0, 96000.0, 384000.0 };
+    juce::String onlyPath;
+    bool verbose = false;
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        auto& arg = args[i];
+        auto next = [&] { return i + 1 < args.size() ? args[++i].text : juce::String(); };
+
+        if (arg == "--rates")
+        {
+            rates.clear();
+
+            for (auto& rate : juce::StringArray::fromTokens (next(), ",", {}))
+                rates.add (juce::jlimit (8000.0, 384000.0, rate.getDoubleValue()));
+        }
+        else if (arg == "--path")     onlyPath = next();
+        else if (arg == "--verbose")  verbose = true;
+        else
+        {
+            std::cerr << "Usage: GoldenOutputCheck [--rates 44100,96000,384000] [--path name] [--verbose]" << std::endl;
+            return 1;
+        }
+    }
+
+    const auto paths = createPaths();
+    const auto corpus = createCorpus (rates);
+
+    struct Summary
+    {
+        Metrics worst;
+        int numCases = 0, numFailed = 0, numUngated = 0;
+    };
+
+    std::map<juce::String, Summary> summaries;
+    juce::Random random (0x474f4c44);
+
+    std::cout << corpus.size() << " cases" << std::endl << std::endl;
+
+    for (auto& testCase : corpus)
+    {
+        // One second of -6 dBFS noise and an impulse, both in double
+        Reference reference;
+        reference.input.resize ((size_t) testCase.rate);
+
+        for (auto& sample : reference.input)
+            sample = (random.nextDouble() * 2.0 - 1.0) * 0.5;
+
+        const auto coefficients = designReference (testCase);
+        reference.output = reference.input;
+        runBiquad (coefficients, reference.output.data(), reference.output.size());
+
+        reference.impulseLength = getImpulseLength (coefficients);
+        std::vector<double> impulse (reference.impulseLength, 0.0);
+        impulse[0] = 1.0;
+        runBiquad (coefficients, impulse.data(), impulse.size());
+        reference.impulseSpectrum = getSpectrum (impulse, testCase.rate);
+
+        auto render = [&] (const std::function<void (std::vector<float>&)>& process)
+        {
+            std::vector<float> output (reference.input.begin(), reference.input.end());
+            std::vector<float> impulseResponse (reference.impulseLength, 0.0f);
+            impulseResponse[0] = 1.0f;
+
+            process (output);
+            process (impulseResponse);
+            return compare (reference, output, impulseResponse, testCase.rate);
+        };
+
+        // The best a float biquad can do with this design
+        const auto baseline = render ([&] (std::vector<float>& samples) { runBiquad (coefficients, samples.data(), samples.size()); });
+        const auto sensitivity = getSensitivity (coefficients, testCase.rate);
+        const auto gated = sensitivity <= illConditionedDb;
+
+        if (verbose)
+            std::cout << testCase.getDescription() << (gated ? "" : "  (ill-conditioned, not gated)") << std::endl
+                      << "    " << juce::String ("float baseline").paddedRight (' ', 20) << format (baseline) << std::endl;
+
+        for (auto& path : paths)
+        {
+            if ((onlyPath.isNotEmpty() && path.name != onlyPath) || ! path.supports (testCase))
+                continue;
+
+            const auto m = render ([&] (std::vector<float>& samples) { path.render (testCase, samples); });
+            const auto& g = path.gate;
+
+            auto within = [&g] (double value, double floor, double baselineValue) { return value <= juce::jmax (floor, baselineValue * g.slack); };
+
+            // Paths whose coefficients round differently can also differ by the ulp sensitivity
+            const auto passed = ! gated
+                             || (within (m.maxError, g.maxError, baseline.maxError)
+                                  && within (m.rmsError, g.rmsError, baseline.rmsError)
+                                  && m.responseDb <= juce::jmax (g.responseDb, baseline.responseDb * g.slack + 2.0 * sensitivity));
+
+            auto& summary = summaries[path.name];
+            summary.numCases++;
+            summary.numFailed += passed ? 0 : 1;
+            summary.numUngated += gated ? 0 : 1;
+            summary.worst.maxError = juce::jmax (summary.worst.maxError, m.maxError);
+            summary.worst.rmsError = juce::jmax (summary.worst.rmsError, m.rmsError);
+            summary.worst.responseDb = juce::jmax (summary.worst.responseDb, m.responseDb);
+
+            if (verbose || ! passed)
+                std::cout << (verbose ? "    " : testCase.getDescription() + "\n    ")
+                          << path.name.paddedRight (' ', 20) << format (m) << (passed ? "" : "  FAILED") << std::endl;
+        }
+    }
+
+    std::cout << std::endl << juce::String ("path").paddedRight (' ', 24)
+              << "   worst max err  worst rms err  worst response    cases  failed  not gated" << std::endl;
+
+    int totalFailed = 0;
+
+    for (auto& [name, summary] : summaries)
+    {
+        std::cout << name.paddedRight (' ', 24) << format (summary.worst)
+                  << juce::String (summary.numCases).paddedLeft (' ', 9)
+                  << juce::String (summary.numFailed).paddedLeft (' ', 8)
+                  << juce::String (summary.numUngated).paddedLeft (' ', 11) << std::endl;
+
+        totalFailed += summary.numFailed;
+    }
+
+    std::cout << std::endl << (totalFailed == 0 ? "PASSED" : "FAILED") << std::endl;
+    return totalFailed == 0 ? 0 : 1;
+}
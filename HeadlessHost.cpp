@@ -0,0 +1,288 @@
+/*
+  ==============================================================================
+
+    HeadlessHost.cpp
+    Created: 19 Oct 2026 10:16:40am
+    Author:  jarre
+
+    Console target that drives the processor through TestHost over a set of
+    host behaviours and checks it behaves.
+
+    Usage: HeadlessHost [--rate 48000] [--max-block 1024] [--seconds 4]
+                        [--scenario fixed|odd|random] [--out <dir>]
+                        [--json <file or ->]
+
+    Each scenario plays seeded noise through the processor with its own block
+    sizes (a fixed 512, a cycle of odd sizes down to 1, or seeded random sizes
+    up to --max-block), while automation ramps a band's frequency, another
+    band's gain, the global gain and the mix, and the state is saved and
+    restored four times a second. A scenario fails if:
+
+        - processBlock allocates
+        - a restored state reads back differently from the saved one
+        - a second run from a fresh processor isn't bit-identical
+        - the output differs from the same run without the state round-trips
+
+    Timings are reported as x-realtime and the slowest block as a fraction of
+    its deadline. --out writes each scenario's output as a WAV file. Exits
+    with 1 if any scenario fails.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "TestHost.h"
+#include "Constants.h"
+
+namespace
+{
+    struct Scenario
+    {
+        juce::String name;
+        std::vector<int> blockSizes;
+    };
+
+    struct Outcome
+    {
+        TestHost::Run run;
+        float maxRepeatDifference = 0.0f, maxRoundTripDifference = 0.0f;
+        juce::var telemetry;
+        bool passed = false;
+    };
+
+    juce::RangedAudioParameter& getParameter (JarEQAudioProcessor& processor, juce::uint16 stableID)
+    {
+        auto* parameter = processor.getParameterByStableID (stableID);
+        jassert (parameter != nullptr);
+        return *parameter;
+    }
+
+    void setPlainValue (JarEQAudioProcessor& processor, juce::uint16 stableID, float value)
+    {
+        auto& parameter = getParameter (processor, stableID);
+        parameter.setValueNotifyingHost (parameter.convertTo0to1 (value));
+    }
+
+    std::unique_ptr<TestHost> createHost (const TestHost::Settings& settings)
+    {
+        auto host = std::make_unique<TestHost> (settings);
+        auto& processor = host->getProcessor();
+
+        // A few bands away from flat, so the cascade has something to do
+        for (int band = 0; band < juce::jmin (4, maxNumFilterBands); ++band)
+        {
+            setPlainValue (processor, StableParameterID::forBand (band, StableParameterID::frequency), 100.0f * std::pow (8.0f, (float) band));
+            setPlainValue (processor, StableParameterID::forBand (band, StableParameterID::Q), 1.4f);
+            setPlainValue (processor, StableParameterID::forBand (band, StableParameterID::gain), band % 2 == 0 ? 6.0f : -6.0f);
+        }
+
+        return host;
+    }
+
+    TestHost::Script createScript (const Scenario& scenario, TestHost& host, juce::int64 numSamples, double sampleRate)
+    {
+        auto& processor = host.getProcessor();
+        const auto half = numSamples / 2;
+
+        TestHost::Script script;
+        script.blockSizes = scenario.blockSizes;
+
+        // Overlapping ramps, dense enough that most blocks carry several points
+        auto indexOf = [&processor] (juce::uint16 stableID) { return getParameter (processor, stableID).getParameterIndex(); };
+
+        script.addRamp (indexOf (StableParameterID::forBand (0, StableParameterID::frequency)), 0, half, 0.2f, 0.7f, 400);
+        script.addRamp (indexOf (StableParameterID::forBand (1, StableParameterID::gain)), half / 4, numSamples, 0.3f, 0.8f, 300);
+        script.addRamp (indexOf (StableParameterID::globalGain), half, numSamples, 0.5f, 0.4f, 50);
+        script.addRamp (indexOf (StableParameterID::mix), 0, numSamples, 0.5f, 0.9f, 50);
+
+        for (auto position = (juce::int64) (sampleRate / 4); position < numSamples; position += (juce::int64) (sampleRate / 4))
+            script.stateRoundTrips.push_back (position);
+
+        return script;
+    }
+
+    float getMaxDifference (const juce::AudioBuffer<float>& a, const juce::AudioBuffer<float>& b)
+    {
+        float worst = 0.0f;
+
+        for (int channel = 0; channel < a.getNumChannels(); ++channel)
+            for (int i = 0; i < a.getNumSamples(); ++i)
+                worst = juce::jmax (worst, std::abs (a.getSample (channel, i) - b.getSample (channel, i)));
+
+        return worst;
+    }
+
+    Outcome runScenario (const Scenario& scenario, const TestHost::Settings& settings, const juce::AudioBuffer<float>& input)
+    {
+        auto host = createHost (settings);
+        const auto script = createScript (scenario, *host, input.getNumSamples(), settings.sampleRate);
+
+        Outcome outcome;
+        outcome.run = host->run (input, script);
+        outcome.telemetry = host->getProcessor().getTelemetry().getSnapshot().toVar();
+
+        const auto repeat = createHost (settings)->run (input, script);
+        outcome.maxRepeatDifference = getMaxDifference (outcome.run.output, repeat.output);
+
+        auto withoutRoundTrips = script;
+        withoutRoundTrips.stateRoundTrips.clear();
+        const auto uninterrupted = createHost (settings)->run (input, withoutRoundTrips);
+        outcome.maxRoundTripDifference = getMaxDifference (outcome.run.output, uninterrupted.output);
+
+        outcome.passed = outcome.run.getTotalAllocations() == 0
+                      && outcome.run.allRoundTripsMatched()
+                      && outcome.maxRepeatDifference == 0.0f
+                      && outcome.maxRoundTripDifference == 0.0f;
+
+        return outcome;
+    }
+
+    bool writeOutput (const juce::File& file, const juce::AudioBuffer<float>& audio, double sampleRate)
+    {
+        file.deleteFile();
+        std::unique_ptr<juce::OutputStream> stream (file.createOutputStream());
+
+        if (stream == nullptr)
+            return false;
+
+        juce::WavAudioFormat wav;
+        std::unique_ptr<juce::AudioFormatWriter> writer (wav.createWriterFor (stream.get(), sampleRate, (unsigned int) audio.getNumChannels(), 32, {}, 0));
+
+        if (writer == nullptr)
+            return false;
+
+        stream.release();
+        return writer->writeFromAudioSampleBuffer (audio, 0, audio.getNumSamples());
+    }
+
+    int fail (const juce::String& message)
+    {
+        std::cerr << message << std::endl;
+        return 1;
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    juce::ArgumentList args (argc, argv);
+
+    TestHost::Settings settings;
+    double seconds = 4.0;
+    juce::String only, jsonPath;
+    juce::File outputDirectory;
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        auto& arg = args[i];
+        auto next = [&] { return i + 1 < args.size() ? args[++i].text : juce::String(); };
+
+        if      (arg == "--rate")       settings.sampleRate = juce::jlimit (8000.0, maxSupportedSampleRate, next().getDoubleValue());
+        else if (arg == "--max-block")  settings.maxBlockSize = juce::jlimit (16, 16384, next().getIntValue());
+        else if (arg == "--seconds")    seconds = juce::jlimit (0.5, 600.0, next().getDoubleValue());
+        else if (arg == "--scenario")   only = next();
+        else if (arg == "--out")        outputDirectory = juce::File::getCurrentWorkingDirectory().getChildFile (next());
+        else if (arg == "--json")       jsonPath = next();
+        else                            return fail ("Unknown option " + arg.text);
+    }
+
+    const std::vector<Scenario> scenarios
+    {
+        { "fixed",  { 512 } },
+        { "odd",    { 1, 7, 33, 441, 1023, 2, 127, 1000 } },
+        { "random", TestHost::makeRandomBlockSizes (509, 1, settings.maxBlockSize, 0x4a4551) }
+    };
+
+    // Seeded stereo noise at -12 dBFS
+    juce::AudioBuffer<float> input (2, (int) (seconds * settings.sampleRate));
+    juce::Random random (0x4a4551);
+
+    for (int channel = 0; channel < 2; ++channel)
+        for (int i = 0; i < input.getNumSamples(); ++i)
+            input.setSample (channel, i, (random.nextFloat() * 2.0f - 1.0f) * 0.25f);
+
+    if (outputDirectory != juce::File() && ! outputDirectory.createDirectory())
+        return fail ("Can't create " + outputDirectory.getFullPathName());
+
+    const bool tableToStdout = jsonPath != "-";
+    juce::Array<juce::var> results;
+    bool allPassed = true;
+    int numRun = 0;
+
+    if (tableToStdout)
+        std::cout << "scenario  blocks  allocs  states  repeat diff  restore diff  x-realtime  worst deadline  result" << std::endl;
+
+    for (auto& scenario : scenarios)
+    {
+        if (only.isNotEmpty() && only != scenario.name)
+            continue;
+
+        // Any sizes above the prepared maximum would be the host breaking its own promise
+        auto clamped = scenario;
+
+        for (auto& size : clamped.blockSizes)
+            size = juce::jmin (size, settings.maxBlockSize);
+
+        const auto outcome = runScenario (clamped, settings, input);
+        const auto& run = outcome.run;
+        const auto allocations = TestHost::isCountingAllocations() ? juce::var (run.getTotalAllocations()) : juce::var();
+        const auto roundTripsMatched = (int) std::count_if (run.roundTrips.begin(), run.roundTrips.end(),
+                                                            [] (const TestHost::RoundTripRecord& r) { return r.stateMatched; });
+
+        allPassed = allPassed && outcome.passed;
+        ++numRun;
+
+        auto* result = new juce::DynamicObject();
+        result->setProperty ("scenario", scenario.name);
+        result->setProperty ("blocks", (int) run.blocks.size());
+        result->setProperty ("allocations", allocations);
+        result->setProperty ("roundTrips", (int) run.roundTrips.size());
+        result->setProperty ("roundTripsMatched", roundTripsMatched);
+        result->setProperty ("maxRepeatDifference", outcome.maxRepeatDifference);
+        result->setProperty ("maxRoundTripDifference", outcome.maxRoundTripDifference);
+        result->setProperty ("realtime", run.getRealtime (settings.sampleRate));
+        result->setProperty ("worstDeadlineRatio", run.getWorstDeadlineRatio (settings.sampleRate));
+        result->setProperty ("telemetry", outcome.telemetry);
+        result->setProperty ("passed", outcome.passed);
+        results.add (result);
+
+        if (tableToStdout)
+            std::cout << scenario.name.paddedRight (' ', 8)
+                      << juce::String ((int) run.blocks.size()).paddedLeft (' ', 8)
+                      << (allocations.isVoid() ? juce::String ("-") : allocations.toString()).paddedLeft (' ', 8)
+                      << (juce::String (roundTripsMatched) + "/" + juce::String ((int) run.roundTrips.size())).paddedLeft (' ', 8)
+                      << juce::String (outcome.maxRepeatDifference, 9).paddedLeft (' ', 13)
+                      << juce::String (outcome.maxRoundTripDifference, 9).paddedLeft (' ', 14)
+                      << juce::String (run.getRealtime (settings.sampleRate), 1).paddedLeft (' ', 12)
+                      << juce::String (run.getWorstDeadlineRatio (settings.sampleRate), 4).paddedLeft (' ', 16)
+                      << (outcome.passed ? "  ok" : "  FAILED") << std::endl;
+
+        if (outputDirectory != juce::File()
+             && ! writeOutput (outputDirectory.getChildFile (scenario.name + ".wav"), run.output, settings.sampleRate))
+            return fail ("Can't write " + scenario.name + ".wav");
+    }
+
+    if (numRun == 0)
+        return fail ("No scenario called " + only);
+
+    if (tableToStdout && ! TestHost::isCountingAllocations())
+        std::cout << "Allocation counting isn't available in this build" << std::endl;
+
+    if (jsonPath.isNotEmpty())
+    {
+        auto* report = new juce::DynamicObject();
+        report->setProperty ("sampleRate", settings.sampleRate);
+        report->setProperty ("maxBlockSize", settings.maxBlockSize);
+        report->setProperty ("seconds", seconds);
+        report->setProperty ("results", results);
+
+        const auto json = juce::JSON::toString (juce::var (report));
+
+        if (jsonPath == "-")
+            std::cout << json << std::endl;
+        else if (! juce::File::getCurrentWorkingDirectory().getChildFile (jsonPath).replaceWithText (json))
+            return fail ("Can't write " + jsonPath);
+    }
+
+    return allPassed ? 0 : 1;
+}
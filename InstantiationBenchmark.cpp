@@ -0,0 +1,103 @@
+/*
+  ==============================================================================
+
+    InstantiationBenchmark.cpp
+    Created: 19 Oct 2026 9:53:45am
+    Author:  jarre
+
+    Console target that measures what a session load costs per instance:
+    construction, prepareToPlay and setStateInformation for N instances.
+
+    Usage: InstantiationBenchmark [numInstances] [maxMillisecondsPerInstance]
+
+    With a limit given, exits with 1 if any stage averages above it, so it
+    can gate regressions in CI.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+namespace
+{
+    struct StageTiming
+    {
+        const char* name;
+        double totalMs = 0.0, worstMs = 0.0;
+
+        template <typename Function>
+        void measure (Function&& function)
+        {
+            auto start = juce::Time::getHighResolutionTicks();
+            function();
+            auto ms = juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - start) * 1000.0;
+
+            totalMs += ms;
+            worstMs = juce::jmax (worstMs, ms);
+        }
+
+        double getAverage (int numInstances) const      { return totalMs / juce::jmax (1, numInstances); }
+    };
+}
+
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const int numInstances = argc > 1 ? juce::jmax (1, juce::String (argv[1]).getIntValue()) : 300;
+    const double limitMs = argc > 2 ? juce::String (argv[2]).getDoubleValue() : 0.0;
+
+    constexpr double rate = 48000.0;
+    constexpr int blockSize = 512;
+
+    // A realistic state blob to restore into every instance
+    juce::MemoryBlock state;
+    {
+        JarEQAudioProcessor source;
+
+        for (auto* parameter : source.getParameters())
+            parameter->setValueNotifyingHost (0.37f);
+
+        source.getStateInformation (state);
+    }
+
+    std::vector<std::unique_ptr<JarEQAudioProcessor>> instances;
+    instances.reserve ((size_t) numInstances);
+
+    StageTiming construction { "construct" }, prepare { "prepareToPlay" }, restore { "setStateInformation" };
+
+    for (int i = 0; i < numInstances; ++i)
+        construction.measure ([&] { instances.push_back (std::make_unique<JarEQAudioProcessor>()); });
+
+    for (auto& instance : instances)
+        prepare.measure ([&] { instance->setRateAndBufferSizeDetails (rate, blockSize);
+                               instance->prepareToPlay (rate, blockSize); });
+
+    for (auto& instance : instances)
+        restore.measure ([&] { instance->setStateInformation (state.getData(), (int) state.getSize()); });
+
+    std::cout << numInstances << " instances, " << state.getSize() << " byte state" << std::endl;
+
+    bool failed = false;
+
+    for (auto* stage : { &construction, &prepare, &restore })
+    {
+        auto average = stage->getAverage (numInstances);
+
+        std::cout << juce::String (stage->name).paddedRight (' ', 20)
+                  << " total " << juce::String (stage->totalMs, 2) << " ms"
+                  << "  avg " << juce::String (average, 4) << " ms"
+                  << "  worst " << juce::String (stage->worstMs, 4) << " ms" << std::endl;
+
+        failed = failed || (limitMs > 0.0 && average > limitMs);
+    }
+
+    for (auto& instance : instances)
+        instance->releaseResources();
+
+    if (failed)
+        std::cout << "FAILED: a stage averaged more than " << limitMs << " ms per instance" << std::endl;
+
+    return failed ? 1 : 0;
+}
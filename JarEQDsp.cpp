@@ -0,0 +1,284 @@
+/*
+  ==============================================================================
+
+    JarEQDsp.cpp
+    Created: 19 Oct 2026 10:05:25am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "JarEQDsp.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <new>
+
+#if defined (__SSE__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 1)
+ #include <xmmintrin.h>
+ #define JAREQ_DSP_SSE_CSR 1
+#endif
+
+namespace
+{
+    constexpr size_t alignment = 64;
+    constexpr double pi = 3.141592653589793238;
+
+    struct alignas (alignment) Coefficients
+    {
+        float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+    };
+
+    struct State
+    {
+        float z1 = 0.0f, z2 = 0.0f;
+    };
+
+    /** Flush-to-zero and denormals-are-zero for the length of a process call, so a
+        decaying filter state never drops into denormals. The caller's mode is restored.
+    */
+    class ScopedFlushDenormals
+    {
+    public:
+       #if JAREQ_DSP_SSE_CSR
+        ScopedFlushDenormals() noexcept  : previous (_mm_getcsr())   { _mm_setcsr (previous | 0x8040); }
+        ~ScopedFlushDenormals()                                      { _mm_setcsr (previous); }
+
+    private:
+        unsigned int previous;
+       #elif defined (__aarch64__)
+        ScopedFlushDenormals() noexcept
+        {
+            asm volatile ("mrs %0, fpcr" : "=r" (previous));
+            asm volatile ("msr fpcr, %0" : : "r" (previous | (1ull << 24)));
+        }
+
+        ~ScopedFlushDenormals()                                      { asm volatile ("msr fpcr, %0" : : "r" (previous)); }
+
+    private:
+        unsigned long long previous;
+       #else
+        ScopedFlushDenormals() noexcept {}
+       #endif
+
+        ScopedFlushDenormals (const ScopedFlushDenormals&) = delete;
+        ScopedFlushDenormals& operator= (const ScopedFlushDenormals&) = delete;
+    };
+}
+
+/** Coefficients first, one cache line per band, then each channel's state for all bands. */
+struct JarEQDsp
+{
+    int numBands = 0, numChannels = 0;
+    double sampleRate = 0.0;
+
+    void* storage = nullptr;
+    size_t allocatedBytes = 0;
+
+    Coefficients* coefficients = nullptr;
+    State* states = nullptr;          // numChannels * numBands, channel-major
+};
+
+//==============================================================================
+JarEQDsp* jareq_dsp_create (int numBands, int numChannels, double sampleRate)
+{
+    if (numBands < 1 || numChannels < 1 || ! (sampleRate > 0.0))
+        return nullptr;
+
+    auto* dsp = new (std::nothrow) JarEQDsp();
+
+    if (dsp == nullptr)
+        return nullptr;
+
+    const auto coefficientBytes = sizeof (Coefficients) * (size_t) numBands;
+    const auto stateBytes = sizeof (State) * (size_t) numBands * (size_t) numChannels;
+
+    dsp->storage = ::operator new (coefficientBytes + stateBytes, std::align_val_t (alignment), std::nothrow);
+
+    if (dsp->storage == nullptr)
+    {
+        delete dsp;
+        return nullptr;
+    }
+
+    dsp->numBands = numBands;
+    dsp->numChannels = numChannels;
+    dsp->sampleRate = sampleRate;
+    dsp->allocatedBytes = sizeof (JarEQDsp) + coefficientBytes + stateBytes;
+    dsp->coefficients = new (dsp->storage) Coefficients[(size_t) numBands];
+    dsp->states = new (static_cast<char*> (dsp->storage) + coefficientBytes) State[(size_t) numBands * (size_t) numChannels];
+
+    return dsp;
+}
+
+void jareq_dsp_destroy (JarEQDsp* dsp)
+{
+    if (dsp == nullptr)
+        return;
+
+    ::operator delete (dsp->storage, std::align_val_t (alignment));
+    delete dsp;
+}
+
+//==============================================================================
+int jareq_dsp_set_band (JarEQDsp* dsp, int band, float frequency, float q, float gainDb)
+{
+    if (dsp == nullptr || band < 0 || band >= dsp->numBands)
+        return -1;
+
+    // Same clamps as juce::Decibels and the plugin's design table
+    const auto omega = std::clamp (2.0 * pi * (double) frequency / dsp->sampleRate, 0.0, pi);
+    const auto gain = gainDb > -100.0f ? std::pow (10.0, (double) gainDb * 0.05) : 0.0;
+    const auto A = std::sqrt (std::max (1.0e-6, gain));
+    const auto alpha = 0.5 * std::sin (omega) / std::max (1.0e-3, (double) q);
+    const auto c2 = -2.0 * std::cos (omega);
+    const auto a0 = 1.0 / (1.0 + alpha / A);
+
+    const float c[5] = { (float) ((1.0 + alpha * A) * a0),
+                         (float) (c2 * a0),
+                         (float) ((1.0 - alpha * A) * a0),
+                         (float) (c2 * a0),
+                         (float) ((1.0 - alpha / A) * a0) };
+
+    return jareq_dsp_set_band_coefficients (dsp, band, c);
+}
+
+int jareq_dsp_set_band_coefficients (JarEQDsp* dsp, int band, const float* c)
+{
+    if (dsp == nullptr || c == nullptr || band < 0 || band >= dsp->numBands)
+        return -1;
+
+    dsp->coefficients[band] = { c[0], c[1], c[2], c[3], c[4] };
+    return 0;
+}
+
+//==============================================================================
+void jareq_dsp_process_planar (JarEQDsp* dsp, float* const* channels, int numChannels, int startFrame, int numFrames)
+{
+    if (dsp == nullptr || channels == nullptr || numFrames <= 0)
+        return;
+
+    const ScopedFlushDenormals noDenormals;
+    numChannels = std::min (numChannels, dsp->numChannels);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        auto* samples = channels[channel] + startFrame;
+        auto* state = dsp->states + channel * dsp->numBands;
+
+        for (int band = 0; band < dsp->numBands; ++band)
+        {
+            const auto c = dsp->coefficients[band];
+            auto z1 = state[band].z1, z2 = state[band].z2;
+
+            // Transposed direct form II
+            for (int i = 0; i < numFrames; ++i)
+            {
+                const auto in = samples[i];
+                const auto out = c.b0 * in + z1;
+                z1 = c.b1 * in - c.a1 * out + z2;
+                z2 = c.b2 * in - c.a2 * out;
+                samples[i] = out;
+            }
+
+            state[band] = { z1, z2 };
+        }
+    }
+}
+
+void jareq_dsp_process_interleaved (JarEQDsp* dsp, float* samples, int numChannels, int numFrames)
+{
+    if (dsp == nullptr || samples == nullptr || numFrames <= 0)
+        return;
+
+    const ScopedFlushDenormals noDenormals;
+    const auto stride = numChannels;
+    numChannels = std::min (numChannels, dsp->numChannels);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        auto* state = dsp->states + channel * dsp->numBands;
+
+        for (int band = 0; band < dsp->numBands; ++band)
+        {
+            const auto c = dsp->coefficients[band];
+            auto z1 = state[band].z1, z2 = state[band].z2;
+            auto* sample = samples + channel;
+
+            for (int i = 0; i < numFrames; ++i, sample += stride)
+            {
+                const auto in = *sample;
+                const auto out = c.b0 * in + z1;
+                z1 = c.b1 * in - c.a1 * out + z2;
+                z2 = c.b2 * in - c.a2 * out;
+                *sample = out;
+            }
+
+            state[band] = { z1, z2 };
+        }
+    }
+}
+
+//==============================================================================
+void jareq_dsp_get_response (const JarEQDsp* dsp, const float* frequencies, float* magnitudesDb, int num)
+{
+    if (dsp == nullptr || frequencies == nullptr || magnitudesDb == nullptr)
+        return;
+
+    for (int j = 0; j < num; ++j)
+    {
+        const auto z = std::polar (1.0, -2.0 * pi * (double) frequencies[j] / dsp->sampleRate);
+        double magnitude = 1.0;
+
+        for (int band = 0; band < dsp->numBands; ++band)
+        {
+            const auto& c = dsp->coefficients[band];
+            const auto numerator = (double) c.b0 + z * ((double) c.b1 + z * (double) c.b2);
+            const auto denominator = 1.0 + z * ((double) c.a1 + z * (double) c.a2);
+
+            magnitude *= std::abs (numerator / denominator);
+        }
+
+        magnitudesDb[j] = magnitude > 1.0e-5 ? (float) (20.0 * std::log10 (magnitude)) : -100.0f;
+    }
+}
+
+void jareq_dsp_reset (JarEQDsp* dsp)
+{
+    if (dsp != nullptr)
+        std::fill (dsp->states, dsp->states + (size_t) dsp->numBands * (size_t) dsp->numChannels, State());
+}
+
+int jareq_dsp_get_decay_samples (const JarEQDsp* dsp, double tolerance)
+{
+    if (dsp == nullptr)
+        return 0;
+
+    const auto logTolerance = std::log (std::clamp (tolerance, 1.0e-15, 0.5));
+    double total = 0.0;
+
+    for (int band = 0; band < dsp->numBands; ++band)
+    {
+        // Each section's state dies away as r^n, r being its largest pole radius
+        const auto a1 = (double) dsp->coefficients[band].a1, a2 = (double) dsp->coefficients[band].a2;
+        const auto discriminant = a1 * a1 - 4.0 * a2;
+        const auto radius = discriminant < 0.0 ? std::sqrt (a2)
+                                               : 0.5 * (std::abs (a1) + std::sqrt (discriminant));
+
+        if (radius >= 1.0)
+            return std::numeric_limits<int>::max();
+
+        // The sections are in series, so their settling times add up
+        if (radius > 0.0)
+            total += logTolerance / std::log (radius);
+    }
+
+    return (int) std::ceil (std::min (total, (double) std::numeric_limits<int>::max()));
+}
+
+size_t jareq_dsp_get_memory_usage (const JarEQDsp* dsp)
+{
+    return dsp != nullptr ? dsp->allocatedBytes : 0;
+}
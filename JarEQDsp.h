@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+
+    JarEQDsp.h
+    Created: 19 Oct 2026 10:05:25am
+    Author:  jarre
+
+    The JarEQ filter cascade as a plain C library.
+
+    JarEQDsp.cpp depends only on the C++17 standard library, so the two files
+    build on their own (no JUCE, no message thread, no GUI) into a static or
+    shared library for embedding in other audio engines. The plugin's
+    FilterBank is a thin wrapper around the same code, so both produce the
+    same output for the same settings.
+
+    All memory is allocated by jareq_dsp_create(); nothing else allocates,
+    locks or blocks, so every other call is safe on a real-time thread. One
+    instance must not be used from two threads at once.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <stddef.h>
+
+#if defined (_WIN32) && defined (JAREQ_DSP_SHARED)
+ #if defined (JAREQ_DSP_BUILDING)
+  #define JAREQ_DSP_API __declspec (dllexport)
+ #else
+  #define JAREQ_DSP_API __declspec (dllimport)
+ #endif
+#elif defined (__GNUC__)
+ #define JAREQ_DSP_API __attribute__ ((visibility ("default")))
+#else
+ #define JAREQ_DSP_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct JarEQDsp JarEQDsp;
+
+/** Returns NULL if the arguments are out of range or allocation fails.
+    Every band starts flat and every channel's state silent.
+*/
+JAREQ_DSP_API JarEQDsp* jareq_dsp_create (int num_bands, int num_channels, double sample_rate);
+JAREQ_DSP_API void jareq_dsp_destroy (JarEQDsp*);
+
+/** Designs a peak band (RBJ cookbook, the plugin's response). Returns 0, or -1 for a bad band index. */
+JAREQ_DSP_API int jareq_dsp_set_band (JarEQDsp*, int band, float frequency, float q, float gain_db);
+
+/** Sets a band's normalised { b0, b1, b2, a1, a2 } directly, for callers with their own design. */
+JAREQ_DSP_API int jareq_dsp_set_band_coefficients (JarEQDsp*, int band, const float* coefficients);
+
+/** Filters frames [start_frame, start_frame + num_frames) of each channel in place.
+    Channels beyond the instance's channel count are left untouched. Both process
+    calls flush denormals to zero while they run and restore the caller's FPU mode.
+*/
+JAREQ_DSP_API void jareq_dsp_process_planar (JarEQDsp*, float* const* channels, int num_channels,
+                                             int start_frame, int num_frames);
+
+/** Filters num_frames frames of interleaved samples in place. */
+JAREQ_DSP_API void jareq_dsp_process_interleaved (JarEQDsp*, float* samples, int num_channels, int num_frames);
+
+/** The combined magnitude response of the current bands, in decibels, at each frequency. */
+JAREQ_DSP_API void jareq_dsp_get_response (const JarEQDsp*, const float* frequencies, float* magnitudes_db, int num);
+
+/** Clears every channel's filter state, keeping the bands. */
+JAREQ_DSP_API void jareq_dsp_reset (JarEQDsp*);
+
+/** Samples for any state to decay below tolerance of its size, or INT_MAX if a band doesn't decay. */
+JAREQ_DSP_API int jareq_dsp_get_decay_samples (const JarEQDsp*, double tolerance);
+
+JAREQ_DSP_API size_t jareq_dsp_get_memory_usage (const JarEQDsp*);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,29 +1,29 @@
-/*
-  ==============================================================================
-
-    MainComponent.h
-    Created: 8 Mar 2023 12:44:24am
-    Author:  jarre
-
-  ==============================================================================
-*/
-
-#pragma once
-
-#include <JuceHeader.h>
-
-//==============================================================================
-/*
-*/
-class MainComponent  : public juce::Component
-{
-public:
-    MainComponent();
-    ~MainComponent() override;
-
-    void paint (juce::Graphics&) override;
-    void resized() override;
-
-private:
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MainComponent)
-};
+/*
+  ==============================================================================
+
+    MainComponent.h
+    Created: 8 Mar 2023 12:44:24am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/*
+*/
+class MainComponent  : public juce::Component
+{
+public:
+    MainComponent();
+    ~MainComponent() override;
+
+    void paint (juce::Graphics&) override;
+    void resized() override;
+
+private:
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MainComponent)
+};
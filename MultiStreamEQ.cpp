@@ -0,0 +1,236 @@
+/*
+  ==============================================================================
+
+    MultiStreamEQ.cpp
+    Created: 19 Oct 2026 10:04:01am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "MultiStreamEQ.h"
+
+//==============================================================================
+MultiStreamEQ::MultiStreamEQ (double sampleRate, int numBandsPerStream)
+    : numBands (numBandsPerStream),
+      designTable (coefficientTables->getPeakTable (sampleRate))
+{
+    static_assert (streamsPerGroup % (int) Register::SIMDNumElements == 0, "A group must fill whole registers");
+    jassert (numBands > 0);
+}
+
+MultiStreamEQ::StreamID MultiStreamEQ::addStream()
+{
+    StreamID id;
+
+    if (! freeIDs.empty())
+    {
+        id = freeIDs.back();
+        freeIDs.pop_back();
+    }
+    else
+    {
+        id = (StreamID) slotForID.size();
+        slotForID.push_back (-1);
+    }
+
+    const auto slot = numStreams++;
+
+    if (slot / streamsPerGroup >= (int) groups.size())
+        addGroup();
+
+    idForSlot.push_back (id);
+    slotForID[(size_t) id] = slot;
+    clearLane (slot);
+    return id;
+}
+
+void MultiStreamEQ::removeStream (StreamID id)
+{
+    jassert (juce::isPositiveAndBelow (id, getStreamIDLimit()) && slotForID[(size_t) id] >= 0);
+
+    const auto slot = slotForID[(size_t) id];
+    const auto last = --numStreams;
+
+    // Keep the active lanes packed by moving the last stream into the hole
+    if (slot != last)
+    {
+        moveLane (last, slot);
+        idForSlot[(size_t) slot] = idForSlot[(size_t) last];
+        slotForID[(size_t) idForSlot[(size_t) slot]] = slot;
+    }
+
+    clearLane (last);
+    idForSlot.pop_back();
+    slotForID[(size_t) id] = -1;
+    freeIDs.push_back (id);
+}
+
+void MultiStreamEQ::reserve (int numStreamsToReserve)
+{
+    while ((int) groups.size() * streamsPerGroup < numStreamsToReserve)
+        addGroup();
+
+    idForSlot.reserve ((size_t) numStreamsToReserve);
+    slotForID.reserve ((size_t) numStreamsToReserve);
+    freeIDs.reserve ((size_t) numStreamsToReserve);
+}
+
+void MultiStreamEQ::setBand (StreamID id, int band, float frequency, float Q, float gainDecibels) noexcept
+{
+    jassert (juce::isPositiveAndBelow (band, numBands));
+
+    const auto slot = slotForID[(size_t) id];
+    float c[5];
+    designTable->designPeak (frequency, Q, gainDecibels, c);
+
+    for (int field = b0; field <= a2; ++field)
+        *getLanes (slot, band, (Field) field) = c[field];
+}
+
+void MultiStreamEQ::resetStream (StreamID id) noexcept
+{
+    const auto slot = slotForID[(size_t) id];
+
+    for (int band = 0; band < numBands; ++band)
+        *getLanes (slot, band, z1) = *getLanes (slot, band, z2) = 0.0f;
+}
+
+//==============================================================================
+float* MultiStreamEQ::getLanes (int slot, int band, Field field) const noexcept
+{
+    const auto& group = groups[(size_t) (slot / streamsPerGroup)];
+    return group.data + ((size_t) band * numFields + (size_t) field) * streamsPerGroup + (size_t) (slot % streamsPerGroup);
+}
+
+void MultiStreamEQ::addGroup()
+{
+    Group group;
+    const auto bytes = sizeof (float) * (size_t) (numBands * numFields * streamsPerGroup) + alignment;
+    group.storage.allocate (bytes, true);
+
+    auto address = reinterpret_cast<std::uintptr_t> (group.storage.get());
+    group.data = reinterpret_cast<float*> (group.storage.get() + ((alignment - (address % alignment)) % alignment));
+
+    groups.push_back (std::move (group));
+
+    // Unused lanes pass their (silent) input straight through
+    for (int lane = 0; lane < streamsPerGroup; ++lane)
+        clearLane (((int) groups.size() - 1) * streamsPerGroup + lane);
+}
+
+void MultiStreamEQ::clearLane (int slot) noexcept
+{
+    for (int band = 0; band < numBands; ++band)
+    {
+        for (int field = 0; field < numFields; ++field)
+            *getLanes (slot, band, (Field) field) = 0.0f;
+
+        *getLanes (slot, band, b0) = 1.0f;
+    }
+}
+
+void MultiStreamEQ::moveLane (int from, int to) noexcept
+{
+    for (int band = 0; band < numBands; ++band)
+        for (int field = 0; field < numFields; ++field)
+            *getLanes (to, band, (Field) field) = *getLanes (from, band, (Field) field);
+}
+
+//==============================================================================
+void MultiStreamEQ::process (float* const* buffersByStream, int numSamples) noexcept
+{
+    processGroups (buffersByStream, numSamples, 0, getNumGroups());
+}
+
+void MultiStreamEQ::processGroups (float* const* buffersByStream, int numSamples, int firstGroup, int numGroupsToProcess) noexcept
+{
+    juce::ScopedNoDenormals noDenormals;
+
+    const auto end = juce::jmin (firstGroup + numGroupsToProcess, getNumGroups());
+
+    for (int group = juce::jmax (0, firstGroup); group < end; ++group)
+        processGroup (buffersByStream, numSamples, group);
+}
+
+void MultiStreamEQ::processGroup (float* const* buffersByStream, int numSamples, int group) noexcept
+{
+    constexpr auto registerSize = (int) Register::SIMDNumElements;
+
+    // One frame of all the group's lanes per sample; small enough to stay in L1
+    alignas (alignment) float frames[blockSamples * streamsPerGroup];
+
+    const auto firstSlot = group * streamsPerGroup;
+    const auto numLanes = juce::jmin (streamsPerGroup, numStreams - firstSlot);
+    auto* base = groups[(size_t) group].data;
+
+    for (int start = 0; start < numSamples; start += blockSamples)
+    {
+        const auto num = juce::jmin (blockSamples, numSamples - start);
+
+        for (int lane = 0; lane < streamsPerGroup; ++lane)
+        {
+            if (lane < numLanes)
+            {
+                const auto* source = buffersByStream[idForSlot[(size_t) (firstSlot + lane)]] + start;
+
+                for (int i = 0; i < num; ++i)
+                    frames[i * streamsPerGroup + lane] = source[i];
+            }
+            else
+            {
+                for (int i = 0; i < num; ++i)
+                    frames[i * streamsPerGroup + lane] = 0.0f;
+            }
+        }
+
+        for (int band = 0; band < numBands; ++band)
+        {
+            auto* lanes = base + (size_t) band * numFields * streamsPerGroup;
+            auto load = [lanes] (Field field, int r) { return Register::fromRawArray (lanes + field * streamsPerGroup + r * registerSize); };
+
+            Register c0[registersPerGroup], c1[registersPerGroup], c2[registersPerGroup],
+                     d1[registersPerGroup], d2[registersPerGroup], s1[registersPerGroup], s2[registersPerGroup];
+
+            for (int r = 0; r < registersPerGroup; ++r)
+            {
+                c0[r] = load (b0, r);
+                c1[r] = load (b1, r);
+                c2[r] = load (b2, r);
+                d1[r] = load (a1, r);
+                d2[r] = load (a2, r);
+                s1[r] = load (z1, r);
+                s2[r] = load (z2, r);
+            }
+
+            // Transposed direct form II, a whole frame of streams per step
+            for (int i = 0; i < num; ++i)
+            {
+                auto* frame = frames + i * streamsPerGroup;
+
+                for (int r = 0; r < registersPerGroup; ++r)
+                {
+                    const auto in = Register::fromRawArray (frame + r * registerSize);
+                    const auto out = c0[r] * in + s1[r];
+                    s1[r] = c1[r] * in - d1[r] * out + s2[r];
+                    s2[r] = c2[r] * in - d2[r] * out;
+                    out.copyToRawArray (frame + r * registerSize);
+                }
+            }
+
+            for (int r = 0; r < registersPerGroup; ++r)
+            {
+                s1[r].copyToRawArray (lanes + z1 * streamsPerGroup + r * registerSize);
+                s2[r].copyToRawArray (lanes + z2 * streamsPerGroup + r * registerSize);
+            }
+        }
+
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            auto* dest = buffersByStream[idForSlot[(size_t) (firstSlot + lane)]] + start;
+
+            for (int i = 0; i < num; ++i)
+                dest[i] = frames[i * streamsPerGroup + lane];
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+    MultiStreamEQ.h
+    Created: 19 Oct 2026 10:04:01am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SharedResources.h"
+
+//==============================================================================
+/**
+    The JarEQ peak cascade applied to many independent mono streams at once,
+    each with its own settings, without any JarEQAudioProcessor.
+
+    Streams are packed sixteen to a group, and every coefficient and state
+    is stored lane by lane (structure of arrays), so one SIMD instruction
+    advances several streams by a sample. A group fills several registers,
+    which gives the CPU independent recursions to interleave. Groups share
+    nothing, so processGroups() can be split across threads.
+
+    Adding a stream fills the next free lane. Removing one moves the last
+    stream into the hole, so the active lanes stay packed. IDs stay valid
+    throughout.
+
+    Setting bands, adding and removing streams must not overlap a
+    process() call. Coefficient changes take effect at the next sample
+    without smoothing.
+*/
+class MultiStreamEQ
+{
+public:
+    using StreamID = int;
+
+    static constexpr int streamsPerGroup = 16;
+
+    MultiStreamEQ (double sampleRate, int numBandsPerStream);
+
+    /** Adds a stream with flat bands and silent state. */
+    StreamID addStream();
+    void removeStream (StreamID);
+
+    /** Preallocates so that adding up to this many streams doesn't allocate. */
+    void reserve (int numStreams);
+
+    int getNumStreams() const noexcept          { return numStreams; }
+    int getNumBands() const noexcept            { return numBands; }
+
+    /** One past the largest ID handed out; the size process() expects its buffer array to be. */
+    int getStreamIDLimit() const noexcept       { return (int) slotForID.size(); }
+
+    void setBand (StreamID, int band, float frequency, float Q, float gainDecibels) noexcept;
+    void resetStream (StreamID) noexcept;
+
+    //==============================================================================
+    /** Processes every stream in place. buffersByStream[id] is stream id's samples;
+        entries for IDs not in use are ignored.
+    */
+    void process (float* const* buffersByStream, int numSamples) noexcept;
+
+    /** Processes only groups [firstGroup, firstGroup + numGroupsToProcess), so that
+        disjoint ranges can run on different threads at the same time.
+    */
+    void processGroups (float* const* buffersByStream, int numSamples, int firstGroup, int numGroupsToProcess) noexcept;
+
+    int getNumGroups() const noexcept           { return (numStreams + streamsPerGroup - 1) / streamsPerGroup; }
+
+private:
+    using Register = juce::dsp::SIMDRegister<float>;
+
+    static constexpr int registersPerGroup = streamsPerGroup / (int) Register::SIMDNumElements;
+    static constexpr int blockSamples = 128;
+    static constexpr size_t alignment = 64;
+
+    enum Field { b0, b1, b2, a1, a2, z1, z2, numFields };
+
+    struct Group
+    {
+        juce::HeapBlock<char> storage;
+        float* data = nullptr;        // [band][field][lane]
+    };
+
+    float* getLanes (int slot, int band, Field field) const noexcept;
+    void addGroup();
+    void clearLane (int slot) noexcept;
+    void moveLane (int from, int to) noexcept;
+    void processGroup (float* const* buffersByStream, int numSamples, int group) noexcept;
+
+    const int numBands;
+    std::vector<Group> groups;
+    std::vector<int> slotForID;       // -1 for IDs not in use
+    std::vector<StreamID> idForSlot, freeIDs;
+    int numStreams = 0;
+
+    juce::SharedResourcePointer<SharedCoefficientTables> coefficientTables;
+    std::shared_ptr<const PeakDesignTable> designTable;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MultiStreamEQ)
+};
@@ -0,0 +1,551 @@
+/*
+  ==============================================================================
+
+    OfflineRenderer.cpp
+    Created: 19 Oct 2026 9:58:53am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "OfflineRenderer.h"
+#include "PluginProcessor.h"
+
+namespace
+{
+    /** Decodes the block at position into block, then processes it in place. */
+    bool readAndProcess (OfflineRenderer::BlockSource& source, JarEQAudioProcessor& processor,
+                         juce::AudioBuffer<float>& block, juce::int64 position)
+    {
+        const auto num = block.getNumSamples();
+
+        if (! source.read (block, num, position))
+            return false;
+
+        // The engine always runs stereo; mono files are fed as a duplicated pair
+        if (source.getReader()->numChannels == 1)
+            block.copyFrom (1, 0, block, 0, 0, num);
+
+        juce::MidiBuffer midi;
+        processor.processBlock (block, midi);
+        return true;
+    }
+}
+
+//==============================================================================
+OfflineRenderer::OfflineRenderer (const Settings& s)
+    : settings (s)
+{
+    formatManager.registerBasicFormats();
+    writerThread.startThread();
+}
+
+OfflineRenderer::~OfflineRenderer()
+{
+    writerThread.stopThread (10000);
+}
+
+//==============================================================================
+OfflineRenderer::BlockSource::BlockSource (juce::AudioFormatManager& formats, const juce::File& file)
+{
+    if (auto* format = formats.findFormatForFileExtension (file.getFileExtension()))
+        mapped.reset (format->createMemoryMappedReader (file));
+
+    if (mapped != nullptr)
+    {
+        reader = mapped.get();
+    }
+    else
+    {
+        streamed.reset (formats.createReaderFor (file));
+        reader = streamed.get();
+    }
+}
+
+bool OfflineRenderer::BlockSource::read (juce::AudioBuffer<float>& dest, int num, juce::int64 position)
+{
+    if (reader == nullptr)
+        return false;
+
+    if (mapped != nullptr)
+    {
+        // Slide the mapped window forward so only a bounded part of the file is ever mapped
+        const juce::Range<juce::int64> wanted (position, position + num);
+
+        if (! window.contains (wanted))
+        {
+            window = { position, juce::jmin (reader->lengthInSamples, position + juce::jmax (windowSamples, (juce::int64) num)) };
+
+            if (! mapped->mapSectionOfFile (window))
+                return false;
+        }
+    }
+
+    return reader->read (&dest, 0, num, position, true, reader->numChannels > 1);
+}
+
+//==============================================================================
+OfflineRenderer::BlockSink::BlockSink (juce::AudioFormatManager& formats, const juce::File& file, const juce::AudioFormatReader& source,
+                                       juce::TimeSliceThread& writerThread, juce::String& error)
+    : numChannels ((int) source.numChannels)
+{
+    auto* format = formats.findFormatForFileExtension (file.getFileExtension());
+
+    if (format == nullptr)
+    {
+        error = "No writer for " + file.getFileExtension();
+        return;
+    }
+
+    file.deleteFile();
+    std::unique_ptr<juce::OutputStream> stream (file.createOutputStream (1 << 20));
+
+    auto bitDepths = format->getPossibleBitDepths();
+    auto bitsPerSample = bitDepths.contains ((int) source.bitsPerSample) ? (int) source.bitsPerSample : bitDepths.getLast();
+
+    std::unique_ptr<juce::AudioFormatWriter> fileWriter (stream != nullptr
+        ? format->createWriterFor (stream.get(), source.sampleRate, (unsigned int) numChannels, bitsPerSample, source.metadataValues, 0)
+        : nullptr);
+
+    if (fileWriter == nullptr)
+    {
+        error = "Can't create " + file.getFullPathName();
+        return;
+    }
+
+    stream.release();   // owned by the writer now
+    writer = std::make_unique<juce::AudioFormatWriter::ThreadedWriter> (fileWriter.release(), writerThread, bufferSamples);
+}
+
+OfflineRenderer::BlockSink::~BlockSink()
+{
+    // Flushes whatever is still buffered and finalises the file
+    writer.reset();
+}
+
+bool OfflineRenderer::BlockSink::write (const juce::AudioBuffer<float>& block, int numSamples)
+{
+    // Wait for the writer thread to drain the other half if it's behind
+    for (int attempts = 0; ! writer->write (block.getArrayOfReadPointers(), numSamples); ++attempts)
+    {
+        if (attempts > 10000)
+            return false;
+
+        juce::Thread::sleep (1);
+    }
+
+    return true;
+}
+
+juce::Result OfflineRenderer::loadPreset()
+{
+    juce::MemoryBlock data;
+
+    if (! settings.presetFile.loadFileAsData (data) || data.isEmpty())
+        return juce::Result::fail ("Can't read preset " + settings.presetFile.getFullPathName());
+
+    // A saved preset is plain XML with a PRESET root
+    if (auto xml = juce::parseXML (data.toString()))
+    {
+        if (xml->hasTagName ("PRESET"))
+        {
+            presetTree = juce::ValueTree::fromXml (*xml);
+            return juce::Result::ok();
+        }
+    }
+
+    // Anything else is treated as a session state blob, binary or XML
+    if (StateCodec::isBinaryState (data.getData(), (int) data.getSize())
+         || juce::AudioProcessor::getXmlFromBinary (data.getData(), (int) data.getSize()) != nullptr)
+    {
+        stateBlob = std::move (data);
+        return juce::Result::ok();
+    }
+
+    return juce::Result::fail ("Not a JarEQ preset or state: " + settings.presetFile.getFullPathName());
+}
+
+juce::Result OfflineRenderer::checkFlatPresetIsTransparent (double sampleRate) const
+{
+    // Every band starts at 0 dB, so a fresh processor is flat
+    JarEQAudioProcessor processor;
+    processor.setPlayConfigDetails (2, 2, sampleRate, settings.blockSize);
+    processor.setNonRealtime (true);
+
+    if (auto* mix = processor.getParameterByStableID (StableParameterID::mix))
+        mix->setValueNotifyingHost (1.0f);
+
+    processor.prepareToPlay (sampleRate, settings.blockSize);
+
+    juce::AudioBuffer<float> input (2, settings.blockSize), block (2, settings.blockSize);
+    juce::MidiBuffer midi;
+    juce::Random random (0x4a4551);
+    double worst = 0.0;
+
+    for (int blockIndex = 0; blockIndex < 64; ++blockIndex)
+    {
+        for (int channel = 0; channel < 2; ++channel)
+            for (int i = 0; i < settings.blockSize; ++i)
+                input.setSample (channel, i, (random.nextFloat() * 2.0f - 1.0f) * 0.5f);
+
+        block.makeCopyOf (input, true);
+        processor.processBlock (block, midi);
+
+        for (int channel = 0; channel < 2; ++channel)
+            for (int i = 0; i < settings.blockSize; ++i)
+                worst = juce::jmax (worst, (double) std::abs (block.getSample (channel, i) - input.getSample (channel, i)));
+    }
+
+    processor.releaseResources();
+
+    if (worst > settings.chunkTolerance)
+        return juce::Result::fail ("A flat preset at full mix changes its input by up to " + juce::String (worst));
+
+    return juce::Result::ok();
+}
+
+std::unique_ptr<JarEQAudioProcessor> OfflineRenderer::createProcessor (double sampleRate) const
+{
+    auto processor = std::make_unique<JarEQAudioProcessor>();
+
+    processor->setPlayConfigDetails (2, 2, sampleRate, settings.blockSize);
+    processor->setNonRealtime (true);
+
+    if (! stateBlob.isEmpty())
+        processor->setStateInformation (stateBlob.getData(), (int) stateBlob.getSize());
+    else if (presetTree.isValid())
+        processor->applyPreset (presetTree);
+
+    processor->prepareToPlay (sampleRate, settings.blockSize);
+    return processor;
+}
+
+juce::File OfflineRenderer::getOutputFileFor (const juce::File& input) const
+{
+    auto extension = settings.outputExtension.isNotEmpty() ? settings.outputExtension : input.getFileExtension();
+    return settings.outputDirectory.getChildFile (input.getFileNameWithoutExtension() + extension);
+}
+
+//==============================================================================
+OfflineRenderer::Result OfflineRenderer::renderFile (const juce::File& input, int fileIndex, Listener* listener)
+{
+    Result result;
+    result.input = input;
+    result.output = getOutputFileFor (input);
+
+    const auto startTicks = juce::Time::getHighResolutionTicks();
+
+    BlockSource source (formatManager, input);
+    auto* reader = source.getReader();
+
+    if (reader == nullptr)
+    {
+        result.error = "Unsupported or unreadable file";
+        return result;
+    }
+
+    const auto numChannels = (int) reader->numChannels;
+
+    if (numChannels < 1 || numChannels > 2)
+    {
+        result.error = "Only mono and stereo files are supported";
+        return result;
+    }
+
+    auto sink = std::make_unique<BlockSink> (formatManager, result.output, *reader, writerThread, result.error);
+
+    if (! sink->isValid())
+        return result;
+
+    auto processor = createProcessor (reader->sampleRate);
+
+    // The one buffer each block lives in: decoded into, processed in place,
+    // then handed to the writer; memory use is independent of file length
+    juce::AudioBuffer<float> buffer (2, settings.blockSize);
+
+    const auto length = reader->lengthInSamples;
+    juce::int64 position = 0;
+    float lastReported = -1.0f;
+
+    while (position < length)
+    {
+        const auto num = (int) juce::jmin ((juce::int64) settings.blockSize, length - position);
+
+        // Only the final block is short; the buffer keeps its allocation
+        if (num != buffer.getNumSamples())
+            buffer.setSize (2, num, false, false, true);
+
+        if (! readAndProcess (source, *processor, buffer, position))
+        {
+            result.error = "Read failed";
+            break;
+        }
+
+        if (! sink->write (buffer, num))
+        {
+            result.error = "Write failed";
+            break;
+        }
+
+        position += num;
+
+        const auto progress = (float) position / (float) length;
+
+        if (listener != nullptr && progress - lastReported >= 0.01f)
+        {
+            listener->fileProgress (fileIndex, progress);
+            lastReported = progress;
+        }
+    }
+
+    processor->releaseResources();
+    sink.reset();
+
+    result.audioSeconds = (double) length / reader->sampleRate;
+    result.wallSeconds = juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - startTicks);
+    return result;
+}
+
+//==============================================================================
+void OfflineRenderer::renderChunk (const juce::File& input, Chunk& chunk, int warmUpSamples)
+{
+    BlockSource source (formatManager, input);
+
+    if (source.getReader() == nullptr)
+    {
+        chunk.error = "Unsupported or unreadable file";
+        return;
+    }
+
+    auto processor = createProcessor (source.getReader()->sampleRate);
+    juce::AudioBuffer<float> scratch (2, settings.blockSize);
+
+    // Run the input leading up to the chunk through the filters and throw the
+    // output away, so the chunk starts from (nearly) the state a sequential
+    // render would have reached there
+    for (auto position = juce::jmax ((juce::int64) 0, chunk.start - warmUpSamples); position < chunk.start;)
+    {
+        const auto num = (int) juce::jmin ((juce::int64) settings.blockSize, chunk.start - position);
+        juce::AudioBuffer<float> block (scratch.getArrayOfWritePointers(), 2, 0, num);
+
+        if (! readAndProcess (source, *processor, block, position))
+        {
+            chunk.error = "Read failed";
+            return;
+        }
+
+        position += num;
+    }
+
+    // Then the chunk itself, processed in place in its own buffer
+    for (int offset = 0; offset < chunk.numSamples; offset += settings.blockSize)
+    {
+        const auto num = juce::jmin (settings.blockSize, chunk.numSamples - offset);
+        juce::AudioBuffer<float> block (chunk.audio.getArrayOfWritePointers(), 2, offset, num);
+
+        if (! readAndProcess (source, *processor, block, chunk.start + offset))
+        {
+            chunk.error = "Read failed";
+            return;
+        }
+    }
+
+    processor->releaseResources();
+}
+
+OfflineRenderer::Result OfflineRenderer::renderFileChunked (const juce::File& input, int fileIndex, Listener* listener, juce::ThreadPool& pool)
+{
+    Result result;
+    result.input = input;
+    result.output = getOutputFileFor (input);
+
+    const auto startTicks = juce::Time::getHighResolutionTicks();
+
+    // Also feeds the sequential reference when verifying
+    BlockSource source (formatManager, input);
+    auto* reader = source.getReader();
+
+    if (reader == nullptr)
+    {
+        result.error = "Unsupported or unreadable file";
+        return result;
+    }
+
+    const auto numChannels = (int) reader->numChannels;
+
+    if (numChannels < 1 || numChannels > 2)
+    {
+        result.error = "Only mono and stereo files are supported";
+        return result;
+    }
+
+    const auto length = reader->lengthInSamples;
+    auto reference = createProcessor (reader->sampleRate);
+    const auto warmUpSamples = reference->getSettlingSamples (settings.chunkTolerance);
+
+    // Chunks several times longer than the warm-up keep its overhead small
+    const auto chunkLength = (int) juce::jlimit ((juce::int64) settings.blockSize, (juce::int64) 1 << 24,
+                                                 juce::jmax ((juce::int64) (settings.chunkSeconds * reader->sampleRate),
+                                                             (juce::int64) warmUpSamples * 8));
+
+    // A band that never settles, or a file too short to gain anything, renders sequentially
+    if (warmUpSamples == std::numeric_limits<int>::max() || length <= chunkLength)
+        return renderFile (input, fileIndex, listener);
+
+    auto sink = std::make_unique<BlockSink> (formatManager, result.output, *reader, writerThread, result.error);
+
+    if (! sink->isValid())
+        return result;
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+
+    for (juce::int64 start = 0; start < length; start += chunkLength)
+    {
+        chunks.push_back (std::make_unique<Chunk>());
+        chunks.back()->start = start;
+        chunks.back()->numSamples = (int) juce::jmin ((juce::int64) chunkLength, length - start);
+    }
+
+    // Only a few chunks ahead of the writer are held in memory at once
+    const auto maxChunksInFlight = 2 * pool.getNumThreads();
+    juce::WaitableEvent chunkFinished;
+    std::atomic<bool> cancelled { false };
+    juce::AudioBuffer<float> referenceBlock (2, settings.blockSize);
+    size_t numQueued = 0;
+
+    for (size_t next = 0; next < chunks.size(); ++next)
+    {
+        while (numQueued < chunks.size() && (int) (numQueued - next) < maxChunksInFlight)
+        {
+            auto& chunk = *chunks[numQueued++];
+            chunk.audio.setSize (2, chunk.numSamples);
+
+            pool.addJob ([this, &input, &chunk, &chunkFinished, &cancelled, warmUpSamples]
+            {
+                if (! cancelled)
+                    renderChunk (input, chunk, warmUpSamples);
+
+                chunk.finished = true;
+                chunkFinished.signal();
+            });
+        }
+
+        auto& chunk = *chunks[next];
+
+        while (! chunk.finished)
+            chunkFinished.wait (100);
+
+        if (chunk.error.isNotEmpty())
+        {
+            result.error = chunk.error;
+            break;
+        }
+
+        if (settings.verifyChunks)
+        {
+            for (int offset = 0; offset < chunk.numSamples; offset += settings.blockSize)
+            {
+                const auto num = juce::jmin (settings.blockSize, chunk.numSamples - offset);
+                juce::AudioBuffer<float> block (referenceBlock.getArrayOfWritePointers(), 2, 0, num);
+
+                if (! readAndProcess (source, *reference, block, chunk.start + offset))
+                {
+                    result.error = "Read failed";
+                    break;
+                }
+
+                for (int channel = 0; channel < numChannels; ++channel)
+                {
+                    auto* expected = block.getReadPointer (channel);
+                    auto* actual = chunk.audio.getReadPointer (channel, offset);
+
+                    for (int i = 0; i < num; ++i)
+                        result.maxChunkError = juce::jmax (result.maxChunkError, (double) std::abs (actual[i] - expected[i]));
+                }
+            }
+        }
+
+        for (int offset = 0; offset < chunk.numSamples && result.error.isEmpty(); offset += writeSliceSamples)
+        {
+            const auto num = juce::jmin (writeSliceSamples, chunk.numSamples - offset);
+
+            if (! sink->write (juce::AudioBuffer<float> (chunk.audio.getArrayOfWritePointers(), 2, offset, num), num))
+                result.error = "Write failed";
+        }
+
+        if (result.error.isNotEmpty())
+            break;
+
+        chunk.audio.setSize (0, 0);
+
+        if (listener != nullptr)
+            listener->fileProgress (fileIndex, (float) (chunk.start + chunk.numSamples) / (float) length);
+    }
+
+    // Jobs still refer to the chunks, so let them all finish before returning
+    cancelled = true;
+
+    for (size_t i = 0; i < numQueued; ++i)
+        while (! chunks[i]->finished)
+            chunkFinished.wait (100);
+
+    sink.reset();
+
+    if (result.error.isEmpty() && settings.verifyChunks && result.maxChunkError > settings.chunkTolerance)
+        result.error = "Chunked output differs from sequential by " + juce::String (result.maxChunkError)
+                         + " (tolerance " + juce::String (settings.chunkTolerance) + ")";
+
+    result.audioSeconds = (double) length / reader->sampleRate;
+    result.wallSeconds = juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - startTicks);
+    return result;
+}
+
+//==============================================================================
+std::vector<OfflineRenderer::Result> OfflineRenderer::renderAll (const juce::Array<juce::File>& inputs, Listener* listener)
+{
+    std::vector<Result> results ((size_t) inputs.size());
+
+    const auto numThreads = settings.numThreads > 0 ? settings.numThreads : juce::SystemStats::getNumCpus();
+
+    if (settings.chunkSeconds > 0.0)
+    {
+        // One file at a time, each split across every thread
+        juce::ThreadPool pool (numThreads);
+        settings.outputDirectory.createDirectory();
+
+        for (int i = 0; i < inputs.size(); ++i)
+        {
+            auto result = renderFileChunked (inputs[i], i, listener, pool);
+
+            if (listener != nullptr)
+                listener->fileFinished (i, result);
+
+            results[(size_t) i] = std::move (result);
+        }
+
+        return results;
+    }
+
+    juce::ThreadPool pool (juce::jmin (numThreads, juce::jmax (1, inputs.size())));
+
+    settings.outputDirectory.createDirectory();
+
+    for (int i = 0; i < inputs.size(); ++i)
+    {
+        pool.addJob ([this, &results, &inputs, listener, i]
+        {
+            auto result = renderFile (inputs[i], i, listener);
+
+            if (listener != nullptr)
+                listener->fileFinished (i, result);
+
+            results[(size_t) i] = std::move (result);
+        });
+    }
+
+    // Each job writes only its own slot, so the results need no locking
+    while (pool.getNumJobs() > 0)
+        juce::Thread::sleep (20);
+
+    return results;
+}
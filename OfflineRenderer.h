@@ -0,0 +1,161 @@
+/*
+  ==============================================================================
+
+    OfflineRenderer.h
+    Created: 19 Oct 2026 9:58:53am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+class JarEQAudioProcessor;
+
+//==============================================================================
+/**
+    Renders audio files through JarEQAudioProcessor::processBlock without a host
+    or an audio device, one processor instance per file, in parallel.
+*/
+class OfflineRenderer
+{
+public:
+    struct Settings
+    {
+        juce::File presetFile;          // .jeqpreset/XML preset or a getStateInformation() blob
+        juce::File outputDirectory;
+        juce::String outputExtension;   // e.g. ".flac"; empty keeps each input's format
+        int blockSize = 512;
+        int numThreads = 0;             // 0 uses every core
+
+        // Chunked mode: each file is split across every thread instead of one file per thread
+        double chunkSeconds = 0.0;      // 0 renders each file sequentially
+        double chunkTolerance = 1.0e-6; // largest allowed difference from a sequential render
+        bool verifyChunks = false;      // also render sequentially and measure the difference
+    };
+
+    struct Result
+    {
+        juce::File input, output;
+        juce::String error;             // empty on success
+        double audioSeconds = 0.0, wallSeconds = 0.0;
+        double maxChunkError = -1.0;    // set when a chunked render was verified
+
+        bool succeeded() const noexcept     { return error.isEmpty(); }
+    };
+
+    /** Called from worker threads as files progress and finish. */
+    struct Listener
+    {
+        virtual ~Listener() = default;
+        virtual void fileProgress (int /*fileIndex*/, float /*proportionDone*/) {}
+        virtual void fileFinished (int /*fileIndex*/, const Result&) {}
+    };
+
+    explicit OfflineRenderer (const Settings&);
+    ~OfflineRenderer();
+
+    /** Reads the preset once; every render applies the same settings. */
+    juce::Result loadPreset();
+
+    /** Renders noise through a flat processor at full mix, which must come out unchanged
+        on both channels to within chunkTolerance. Run before trusting any render.
+    */
+    juce::Result checkFlatPresetIsTransparent (double sampleRate) const;
+
+    /** Renders every input and blocks until all are done. Results are in input order. */
+    std::vector<Result> renderAll (const juce::Array<juce::File>& inputs, Listener* listener = nullptr);
+
+    /** Renders one file on the calling thread. */
+    Result renderFile (const juce::File& input, int fileIndex, Listener* listener);
+
+    /** Renders one file as chunks on the pool. Each chunk's filters are first warmed up on
+        the input before it, for as long as the cascade takes to settle to chunkTolerance,
+        and the chunks are written out in order as they complete.
+    */
+    Result renderFileChunked (const juce::File& input, int fileIndex, Listener* listener, juce::ThreadPool&);
+
+    juce::AudioFormatManager& getFormatManager() noexcept   { return formatManager; }
+
+    //==============================================================================
+    /**
+        Reads fixed-size blocks straight into the caller's processing buffer.
+
+        Formats that support it (WAV, AIFF) are read through a memory-mapped
+        reader over a sliding window, so a file of any length costs the same
+        resident memory. Other formats fall back to a buffered stream reader.
+    */
+    class BlockSource
+    {
+    public:
+        BlockSource (juce::AudioFormatManager&, const juce::File&);
+
+        juce::AudioFormatReader* getReader() const noexcept     { return reader; }
+        bool isMemoryMapped() const noexcept                    { return mapped != nullptr; }
+
+        /** Fills channels 0 (and 1 for stereo files) of dest with samples [position, position + num). */
+        bool read (juce::AudioBuffer<float>& dest, int num, juce::int64 position);
+
+    private:
+        static constexpr juce::int64 windowSamples = 1 << 22;
+
+        std::unique_ptr<juce::MemoryMappedAudioFormatReader> mapped;
+        std::unique_ptr<juce::AudioFormatReader> streamed;
+        juce::AudioFormatReader* reader = nullptr;
+        juce::Range<juce::int64> window;
+    };
+
+    /**
+        Hands processed blocks to a ThreadedWriter, which double-buffers them
+        and writes on the renderer's background thread, so encoding and disk
+        writes overlap with processing.
+    */
+    class BlockSink
+    {
+    public:
+        BlockSink (juce::AudioFormatManager&, const juce::File&, const juce::AudioFormatReader& source,
+                   juce::TimeSliceThread& writerThread, juce::String& error);
+        ~BlockSink();
+
+        bool isValid() const noexcept       { return writer != nullptr; }
+
+        /** Queues the first numChannels channels; waits only if both buffers are full. */
+        bool write (const juce::AudioBuffer<float>& block, int numSamples);
+
+    private:
+        static constexpr int bufferSamples = 1 << 17;
+
+        std::unique_ptr<juce::AudioFormatWriter::ThreadedWriter> writer;
+        int numChannels = 0;
+    };
+
+private:
+    struct Chunk
+    {
+        juce::int64 start = 0;
+        int numSamples = 0;
+        juce::AudioBuffer<float> audio;
+        juce::String error;
+        std::atomic<bool> finished { false };
+    };
+
+    void renderChunk (const juce::File& input, Chunk&, int warmUpSamples);
+
+    // Finished chunks are queued to the writer a slice at a time, well inside its buffer
+    static constexpr int writeSliceSamples = 1 << 15;
+
+    std::unique_ptr<JarEQAudioProcessor> createProcessor (double sampleRate) const;
+    juce::File getOutputFileFor (const juce::File& input) const;
+
+    Settings settings;
+    juce::AudioFormatManager formatManager;
+    juce::TimeSliceThread writerThread { "JarEQ render writer" };
+
+    // Exactly one of these is set by loadPreset()
+    juce::MemoryBlock stateBlob;
+    juce::ValueTree presetTree;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (OfflineRenderer)
+};
@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+
+    ParameterBatch.cpp
+    Created: 19 Oct 2026 9:49:16am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "ParameterBatch.h"
+
+//==============================================================================
+ParameterBatch::ParameterBatch (juce::AudioProcessor& processorToUpdate, std::atomic<juce::uint32>& generationToBump)
+    : processor (processorToUpdate), generation (generationToBump)
+{
+    staged.reserve ((size_t) processor.getParameters().size());
+}
+
+void ParameterBatch::stage (juce::RangedAudioParameter* parameter, float plainValue)
+{
+    if (parameter != nullptr)
+        stageNormalised (parameter, parameter->convertTo0to1 (plainValue));
+}
+
+void ParameterBatch::stageNormalised (juce::AudioProcessorParameter* parameter, float normalisedValue)
+{
+    if (parameter == nullptr)
+        return;
+
+    normalisedValue = juce::jlimit (0.0f, 1.0f, normalisedValue);
+
+    for (auto& change : staged)
+    {
+        if (change.parameter == parameter)
+        {
+            change.normalisedValue = normalisedValue;
+            return;
+        }
+    }
+
+    staged.push_back ({ parameter, normalisedValue });
+}
+
+void ParameterBatch::apply()
+{
+    if (staged.empty())
+        return;
+
+    // Odd while writing, so the audio thread holds its current coefficients
+    generation.fetch_add (1, std::memory_order_relaxed);
+
+    // Pairs with the audio thread's fence, so a reader that sees any new value also sees the odd generation
+    std::atomic_thread_fence (std::memory_order_release);
+
+    for (auto& change : staged)
+        if (change.parameter->getValue() != change.normalisedValue)
+            change.parameter->setValue (change.normalisedValue);
+
+    generation.fetch_add (1, std::memory_order_release);
+
+    staged.clear();
+
+    // One notification for the whole set; hosts re-read every value and
+    // AudioProcessorListeners (including our editor) refresh once
+    processor.updateHostDisplay (juce::AudioProcessor::ChangeDetails().withParameterInfoChanged (true));
+}
@@ -0,0 +1,55 @@
+/*
+  ==============================================================================
+
+    ParameterBatch.h
+    Created: 19 Oct 2026 9:49:16am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Stages a set of parameter values and applies them as one change.
+
+    apply() writes every staged value without the per-parameter host and
+    listener notifications, bumps the processor's parameter generation once
+    so the audio thread rebuilds its coefficients in a single pass, and sends
+    one grouped updateHostDisplay(). While the values are being written the
+    generation is odd, which tells the audio thread to keep its previous
+    coefficients rather than pick up a half-applied preset.
+*/
+class ParameterBatch
+{
+public:
+    ParameterBatch (juce::AudioProcessor& processorToUpdate, std::atomic<juce::uint32>& generationToBump);
+
+    /** Stages a value in the parameter's own (plain) range; a later stage of the same parameter wins. */
+    void stage (juce::RangedAudioParameter* parameter, float plainValue);
+
+    /** Stages a normalised 0..1 value. */
+    void stageNormalised (juce::AudioProcessorParameter* parameter, float normalisedValue);
+
+    bool isEmpty() const noexcept       { return staged.empty(); }
+    void clear() noexcept               { staged.clear(); }
+
+    /** Applies everything staged and clears the batch. Only one batch should be applied at a time. */
+    void apply();
+
+private:
+    struct Change
+    {
+        juce::AudioProcessorParameter* parameter;
+        float normalisedValue;
+    };
+
+    juce::AudioProcessor& processor;
+    std::atomic<juce::uint32>& generation;
+    std::vector<Change> staged;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterBatch)
+};
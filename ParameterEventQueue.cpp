@@ -0,0 +1,159 @@
+/*
+  ==============================================================================
+
+    ParameterEventQueue.cpp
+    Created: 19 Oct 2026 9:57:44am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "ParameterEventQueue.h"
+
+//==============================================================================
+ParameterEventQueue::ParameterEventQueue (int capacity)
+    : pending ((size_t) capacity)
+{
+    for (int i = 0; i < maxWriterThreads; ++i)
+        lanes.push_back (std::make_unique<Lane> (capacity));
+}
+
+ParameterEventQueue::~ParameterEventQueue()
+{
+    detach();
+}
+
+void ParameterEventQueue::attachTo (juce::AudioProcessor& processor)
+{
+    detach();
+
+    for (auto* parameter : processor.getParameters())
+        parameter->addListener (this);
+
+    attachedProcessor = &processor;
+}
+
+void ParameterEventQueue::detach()
+{
+    if (attachedProcessor != nullptr)
+        for (auto* parameter : attachedProcessor->getParameters())
+            parameter->removeListener (this);
+
+    attachedProcessor = nullptr;
+}
+
+//==============================================================================
+ParameterEventQueue::Lane* ParameterEventQueue::getLaneForThisThread() noexcept
+{
+    const auto thisThread = juce::Thread::getCurrentThreadId();
+
+    for (auto& lane : lanes)
+        if (lane->owner.load (std::memory_order_acquire) == thisThread)
+            return lane.get();
+
+    // Lanes are claimed for good: a thread that writes once is likely to write again
+    for (auto& lane : lanes)
+    {
+        juce::Thread::ThreadID expected = nullptr;
+
+        if (lane->owner.compare_exchange_strong (expected, thisThread, std::memory_order_acq_rel))
+            return lane.get();
+    }
+
+    return nullptr;
+}
+
+bool ParameterEventQueue::push (int parameterIndex, int sampleOffset, float normalisedValue) noexcept
+{
+    auto* lane = getLaneForThisThread();
+
+    if (lane == nullptr || lane->fifo.getFreeSpace() < 1)
+    {
+        overflowed = true;
+        return false;
+    }
+
+    const auto scope = lane->fifo.write (1);
+    lane->events[(size_t) scope.startIndex1] = { parameterIndex, juce::jmax (0, sampleOffset), normalisedValue };
+    return true;
+}
+
+bool ParameterEventQueue::addToBlock (Event event, Event* dest, int& count, int maxEvents, int numSamples) noexcept
+{
+    if (event.sampleOffset >= numSamples)
+    {
+        if (numPending == (int) pending.size())
+        {
+            overflowed = true;
+            return false;
+        }
+
+        event.sampleOffset -= numSamples;
+        pending[(size_t) numPending++] = event;
+        return true;
+    }
+
+    if (count == maxEvents)
+        return false;
+
+    // Insertion sort keeps arrival order for equal offsets and never allocates
+    int position = count++;
+
+    while (position > 0 && dest[position - 1].sampleOffset > event.sampleOffset)
+    {
+        dest[position] = dest[position - 1];
+        --position;
+    }
+
+    dest[position] = event;
+    return true;
+}
+
+int ParameterEventQueue::popBlock (Event* dest, int maxEvents, int numSamples) noexcept
+{
+    int count = 0;
+
+    // Events carried over from earlier blocks arrived before anything in the lanes
+    const auto numCarried = numPending;
+    numPending = 0;
+
+    for (int i = 0; i < numCarried; ++i)
+    {
+        if (! addToBlock (pending[(size_t) i], dest, count, maxEvents, numSamples))
+        {
+            // No room in dest: keep the rest for the next block, in order
+            std::copy (pending.begin() + i, pending.begin() + numCarried, pending.begin() + numPending);
+            numPending += numCarried - i;
+            break;
+        }
+    }
+
+    for (auto& lane : lanes)
+    {
+        // Anything that does not fit stays in its lane for the next block
+        const auto numReady = juce::jmin (lane->fifo.getNumReady(),
+                                          maxEvents - count,
+                                          (int) pending.size() - numPending);
+
+        if (numReady <= 0)
+            continue;
+
+        const auto scope = lane->fifo.read (numReady);
+        scope.forEach ([&] (int index) { addToBlock (lane->events[(size_t) index], dest, count, maxEvents, numSamples); });
+    }
+
+    return count;
+}
+
+void ParameterEventQueue::clear() noexcept
+{
+    for (auto& lane : lanes)
+        lane->fifo.reset();
+
+    numPending = 0;
+}
+
+void ParameterEventQueue::parameterValueChanged (int parameterIndex, float newValue)
+{
+    push (parameterIndex, 0, newValue);
+}
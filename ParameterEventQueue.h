@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    ParameterEventQueue.h
+    Created: 19 Oct 2026 9:57:44am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Preallocated queue of parameter changes for the audio thread.
+
+    Every change to an attached processor's parameters is queued as it happens.
+    The audio thread takes a whole block's worth at once, in sample order, and
+    splits its processing at the event positions.
+
+    JUCE's wrappers apply a block's automation before processBlock without
+    saying where in the block each change falls, so changes heard through
+    the parameter listener are queued at offset 0. Hosts or harnesses that
+    know the real offsets can push() events directly.
+
+    Listeners fire on whichever thread changed the parameter, the audio thread
+    included, so push() never locks: each writer thread claims its own
+    single-writer lane on first use and the audio thread reads every lane.
+*/
+class ParameterEventQueue  : private juce::AudioProcessorParameter::Listener
+{
+public:
+    struct Event
+    {
+        int parameterIndex;
+        int sampleOffset;
+        float normalisedValue;
+    };
+
+    explicit ParameterEventQueue (int capacity = 1024);
+    ~ParameterEventQueue() override;
+
+    /** Listens to every parameter of the processor. */
+    void attachTo (juce::AudioProcessor&);
+    void detach();
+
+    /** Any thread, never blocks. Returns false if the thread's lane is full or
+        every lane is taken by other threads; see hasOverflowed().
+    */
+    bool push (int parameterIndex, int sampleOffset, float normalisedValue) noexcept;
+
+    /** Audio thread: moves the pending events that fall inside this block into dest,
+        sorted by sample offset, and returns how many. Events further ahead stay
+        queued, their offsets moved on by numSamples.
+    */
+    int popBlock (Event* dest, int maxEvents, int numSamples) noexcept;
+
+    /** Audio thread: true once if events were dropped since the last call,
+        meaning the caller should re-read the parameters directly.
+    */
+    bool hasOverflowed() noexcept       { return overflowed.exchange (false); }
+
+    /** Only while nothing else is pushing or popping, e.g. in prepareToPlay. */
+    void clear() noexcept;
+
+    int getCapacity() const noexcept    { return (int) pending.size(); }
+
+private:
+    void parameterValueChanged (int parameterIndex, float newValue) override;
+    void parameterGestureChanged (int, bool) override {}
+
+    // Message thread, audio thread and the odd host automation thread
+    static constexpr int maxWriterThreads = 4;
+
+    struct Lane
+    {
+        explicit Lane (int capacity) : events ((size_t) capacity), fifo (capacity) {}
+
+        std::atomic<juce::Thread::ThreadID> owner { nullptr };
+        std::vector<Event> events;
+        juce::AbstractFifo fifo;
+    };
+
+    Lane* getLaneForThisThread() noexcept;
+    bool addToBlock (Event event, Event* dest, int& count, int maxEvents, int numSamples) noexcept;
+
+    std::vector<std::unique_ptr<Lane>> lanes;
+    std::atomic<bool> overflowed { false };
+
+    // Audio thread only: events read from the lanes that belong to a later block
+    std::vector<Event> pending;
+    int numPending = 0;
+
+    juce::AudioProcessor* attachedProcessor = nullptr;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterEventQueue)
+};
@@ -1,221 +1,495 @@
-// PluginEditor.cpp
-
-#include "PluginEditor.h"
-
-JarEQAudioProcessorEditor::JarEQAudioProcessorEditor (JarEQAudioProcessor& p)
-    : AudioProcessorEditor (&p),
-      audioProcessor (p)
-{
-    // Set up GUI components
-setSize (600, 400);
-
-titleLabel.setText ("JarEQ", juce::NotificationType::dontSendNotification);
-titleLabel.setFont (juce::Font (24.0f, juce::Font::bold));
-addAndMakeVisible (titleLabel);
-
-globalGainLabel.setText ("Global Gain", juce::NotificationType::dontSendNotification);
-addAndMakeVisible (globalGainLabel);
-
-globalGainSlider.setSliderStyle (juce::Slider::LinearHorizontal);
-globalGainSlider.setRange (-48.0f, 48.0f, 0.1f);
-globalGainSlider.setTextBoxStyle (juce::Slider::TextBoxBelow, true, 80, 20);
-globalGainSlider.setValue (*audioProcessor.globalGainParam);
-globalGainSlider.addListener (this);
-addAndMakeVisible (globalGainSlider);
-
-mixLabel.setText ("Mix", juce::NotificationType::dontSendNotification);
-addAndMakeVisible (mixLabel);
-
-mixSlider.setSliderStyle (juce::Slider::LinearHorizontal);
-mixSlider.setRange (0.0f, 1.0f, 0.01f);
-mixSlider.setTextBoxStyle (juce::Slider::TextBoxBelow, true, 80, 20);
-mixSlider.setValue (*audioProcessor.mixParam);
-mixSlider.addListener (this);
-addAndMakeVisible (mixSlider);
-
-bypassButton.setButtonText ("Bypass");
-bypassButton.addListener (this);
-addAndMakeVisible (bypassButton);
-
-analyzerButton.setButtonText ("Analyzer");
-analyzerButton.addListener (this);
-addAndMakeVisible (analyzerButton);
-
-for (int i = 0; i < maxNumFilterBands; ++i)
-{
-    frequencyLabels[i].setText ("Freq", juce::NotificationType::dontSendNotification);
-    addAndMakeVisible (frequencyLabels[i]);
-
-    gainLabels[i].setText ("Gain", juce::NotificationType::dontSendNotification);
-    addAndMakeVisible (gainLabels[i]);
-
-    QLabels[i].setText ("Q", juce::NotificationType::dontSendNotification);
-    addAndMakeVisible (QLabels[i]);
-
-    typeLabels[i].setText ("Type", juce::NotificationType::dontSendNotification);
-    addAndMakeVisible (typeLabels[i]);
-
-    frequencySliders[i].setSliderStyle (juce::Slider::LinearHorizontal);
-    frequencySliders[i].setRange (20.0f, 20000.0f, 0.1f);
-    frequencySliders[i].setValue (*audioProcessor.frequencyParams[i]);
-    frequencySliders[i].setTextBoxStyle (juce::Slider::TextBoxBelow, true, 80, 20);
-    frequencySliders[i].addListener (this);
-    addAndMakeVisible (frequencySliders[i]);
-
-    gainSliders[i].setSliderStyle (juce::Slider::LinearVertical);
-    gainSliders[i].setRange (-24.0f, 24.0f, 0.1f);
-    gainSliders[i].setValue (*audioProcessor.gainParams[i]);
-    gainSliders[i].setTextBoxStyle (juce::Slider::TextBoxBelow, true, 80, 20);
-    gainSliders[i].addListener (this);
-    addAndMakeVisible (gainSliders[i]);
-
-    
-    QSliders[i].setSliderStyle (juce::Slider::LinearVertical);
-    QSliders[i].setRange (0.1f, 10.0f, 0.1f);
-    QSliders[i].setValue (*audioProcessor.QParams[i]);
-    QSliders[i].setTextBoxStyle (juce::Slider::TextBoxBelow, true, 80, 20);
-    QSliders[i].addListener (this);
-    addAndMakeVisible (QSliders[i]);
-
-    typeComboBoxes[i].addItem ("Low Pass", 1);
-    typeComboBoxes[i].addItem ("High Pass", 2);
-    typeComboBoxes[i].addItem ("Band Pass", 3);
-    typeComboBoxes[i].addItem ("Notch", 4);
-    typeComboBoxes[i].addItem ("All Pass", 5);
-    typeComboBoxes[i].addItem ("Peak", 6);
-    typeComboBoxes[i].addItem ("Low Shelf", 7);
-    typeComboBoxes[i].addItem ("High Shelf", 8);
-    typeComboBoxes[i].setSelectedId (*audioProcessor.typeParams[i]);
-    typeComboBoxes[i].addListener (this);
-    addAndMakeVisible (typeComboBoxes[i]);
-}
-
-// Set up the layout
-resized();
-
-}
-
-JarEQAudioProcessorEditor::~JarEQAudioProcessorEditor()
-{
-}
-
-void JarEQAudioProcessorEditor::paint (juce::Graphics& g)
-{
-g.fillAll (juce::Colours::black);
-}
-
-void JarEQAudioProcessorEditor::resized()
-{
-int y = 10;
-// Title
-titleLabel.setBounds (10, y, getWidth() - 20, 30);
-y += 40;
-
-// Global gain
-globalGainLabel.setBounds (10, y, 80, 20);
-globalGainSlider.setBounds (100, y, getWidth() - 120, 20);
-y += 30;
-
-// Mix
-mixLabel.setBounds (10, y, 80, 20);
-mixSlider.setBounds (100, y, getWidth() - 120, 20);
-y += 30;
-
-// Bypass and analyzer buttons
-bypassButton.setBounds (10, y, 80, 20);
-analyzerButton.setBounds (100, y, 80, 20);
-y += 30;
-
-// Filter bands
-for (int i = 0; i < audioProcessor.getNumFilterBands(); ++i)
-{
-    frequencyLabels[i].setBounds (10, y, 50, 20);
-    gainLabels[i].setBounds (70, y, 50, 20);
-    QLabels[i].setBounds (130, y, 50, 20);
-    typeLabels[i].setBounds (190, y, 50, 20);
-    frequencySliders[i].setBounds (10, y + 20, 50, 100);
-    gainSliders[i].setBounds (70, y + 20, 50, 100);
-    QSliders[i].setBounds (130, y + 20, 50, 100);
-    typeComboBoxes[i].setBounds (190, y + 20, 80, 20);
-    y += 130;
-}
-}
-
-void JarEQAudioProcessorEditor::sliderValueChanged (juce::Slider* slider)
-{
-    }
-
-void JarEQAudioProcessorEditor::buttonClicked (juce::Button* button)
-{
-if (button == &bypassButton)
-{
-audioProcessor.bypassed = !audioProcessor.bypassed;
-}
-else if (button == &analyzerButton)
-{
-audioProcessor.analyzerEnabled = !audioProcessor.analyzerEnabled;
-}
-}
-
-void JarEQAudioProcessorEditor::comboBoxChanged (juce::ComboBox* comboBox)
-{
-for (int i = 0; i < audioProcessor.getNumFilterBands(); ++i)
-{
-if (comboBox == &typeComboBoxes[i])
-{
-*audioProcessor.typeParams[i] = comboBox->getSelectedId();
-}
-}
-}
-
-// Analyzer class
-
-JarEQAnalyzer::JarEQAnalyzer (JarEQAudioProcessor& p) : audioProcessor (p)
-{
-}
-
-void JarEQAnalyzer::paint (juce::Graphics& g)
-{
-g.fillAll (juce::Colours::black);
-    g.setColour (juce::Colours::white);
-
-juce::Path path;
-
-const auto waveform = audioProcessor.getWaveform();
-
-if (! waveform.isEmpty())
-{
-    auto xRatio = getLocalBounds().getWidth() / (float) waveform.getNumSamples();
-    auto yRatio = getLocalBounds().getHeight() / 2.0f;
-
-    path.startNewSubPath (0, yRatio);
-
-    for (int i = 0; i < waveform.getNumSamples(); ++i)
-    {
-        path.lineTo (i * xRatio, yRatio - waveform[i] * yRatio);
-    }
-
-    g.strokePath (path, juce::PathStrokeType (1.0f));
-}
-
-}
-
-void JarEQAnalyzer::resized()
-{
-}
-
-void JarEQAnalyzer::timerCallback()
-{
-repaint();
-}
-
-void JarEQAnalyzer::start()
-{
-startTimerHz (60);
-}
-
-void JarEQAnalyzer::stop()
-{
-stopTimer();
-}
-
+// PluginEditor.cpp
+
+#include "PluginEditor.h"
+#include "FrequencyMapping.h"
+
+JarEQAudioProcessorEditor::JarEQAudioProcessorEditor (JarEQAudioProcessor& p)
+    : AudioProcessorEditor (&p),
+      audioProcessor (p),
+      analyzer (p, analyserScheduler)
+{
+    // Set up GUI components
+setSize (600, 400);
+setOpaque (true);
+
+titleLabel.setText ("JarEQ", juce::NotificationType::dontSendNotification);
+titleLabel.setFont (juce::Font (24.0f, juce::Font::bold));
+addAndMakeVisible (titleLabel);
+
+// Callback load and deadline misses, so a crackling session can be pinned on us or not
+telemetryLabel.setFont (juce::Font (11.0f));
+telemetryLabel.setColour (juce::Label::textColourId, juce::Colours::grey);
+telemetryLabel.setJustificationType (juce::Justification::centredRight);
+addAndMakeVisible (telemetryLabel);
+startTimerHz (4);
+
+globalGainLabel.setText ("Global Gain", juce::NotificationType::dontSendNotification);
+addAndMakeVisible (globalGainLabel);
+
+globalGainSlider.setSliderStyle (juce::Slider::LinearHorizontal);
+globalGainSlider.setRange (-48.0f, 48.0f, 0.1f);
+globalGainSlider.setTextBoxStyle (juce::Slider::TextBoxBelow, true, 80, 20);
+globalGainSlider.setValue (*audioProcessor.globalGainParam);
+globalGainSlider.addListener (this);
+addAndMakeVisible (globalGainSlider);
+
+mixLabel.setText ("Mix", juce::NotificationType::dontSendNotification);
+addAndMakeVisible (mixLabel);
+
+mixSlider.setSliderStyle (juce::Slider::LinearHorizontal);
+mixSlider.setRange (0.0f, 1.0f, 0.01f);
+mixSlider.setTextBoxStyle (juce::Slider::TextBoxBelow, true, 80, 20);
+mixSlider.setValue (*audioProcessor.mixParam);
+mixSlider.addListener (this);
+addAndMakeVisible (mixSlider);
+
+bypassButton.setButtonText ("Bypass");
+bypassButton.addListener (this);
+addAndMakeVisible (bypassButton);
+
+analyzerButton.setButtonText ("Analyzer");
+analyzerButton.addListener (this);
+addAndMakeVisible (analyzerButton);
+
+undoButton.setButtonText ("Undo");
+undoButton.onClick = [this] { audioProcessor.getUndoHistory().undo(); };
+addAndMakeVisible (undoButton);
+
+redoButton.setButtonText ("Redo");
+redoButton.onClick = [this] { audioProcessor.getUndoHistory().redo(); };
+addAndMakeVisible (redoButton);
+
+// A/B slots: store the current settings, then morph between them
+storeAButton.setButtonText ("Store A");
+storeAButton.onClick = [this] { audioProcessor.storeMorphSnapshot (PresetMorph::Slot::A); };
+addAndMakeVisible (storeAButton);
+
+storeBButton.setButtonText ("Store B");
+storeBButton.onClick = [this] { audioProcessor.storeMorphSnapshot (PresetMorph::Slot::B); };
+addAndMakeVisible (storeBButton);
+
+// Hands the bands back to their own knobs, presets and automation
+clearMorphButton.setButtonText ("A/B Off");
+clearMorphButton.onClick = [this] { audioProcessor.clearMorphSnapshots(); };
+addAndMakeVisible (clearMorphButton);
+
+morphSlider.setSliderStyle (juce::Slider::LinearHorizontal);
+morphSlider.setRange (0.0f, 1.0f, 0.001f);
+morphSlider.setTextBoxStyle (juce::Slider::NoTextBox, true, 0, 0);
+morphSlider.setValue (audioProcessor.getMorphParameter().get(), juce::dontSendNotification);
+morphSlider.onDragStart = [this] { audioProcessor.getMorphParameter().beginChangeGesture(); };
+morphSlider.onValueChange = [this] { audioProcessor.getMorphParameter() = (float) morphSlider.getValue(); };
+morphSlider.onDragEnd = [this] { audioProcessor.getMorphParameter().endChangeGesture(); };
+addAndMakeVisible (morphSlider);
+
+for (int i = 0; i < maxNumFilterBands; ++i)
+{
+    frequencyLabels[i].setText ("Freq", juce::NotificationType::dontSendNotification);
+    addAndMakeVisible (frequencyLabels[i]);
+
+    gainLabels[i].setText ("Gain", juce::NotificationType::dontSendNotification);
+    addAndMakeVisible (gainLabels[i]);
+
+    QLabels[i].setText ("Q", juce::NotificationType::dontSendNotification);
+    addAndMakeVisible (QLabels[i]);
+
+    typeLabels[i].setText ("Type", juce::NotificationType::dontSendNotification);
+    addAndMakeVisible (typeLabels[i]);
+
+    frequencySliders[i].setSliderStyle (juce::Slider::LinearHorizontal);
+    frequencySliders[i].setRange (20.0f, 20000.0f, 0.1f);
+    frequencySliders[i].setValue (*audioProcessor.frequencyParams[i]);
+    frequencySliders[i].setTextBoxStyle (juce::Slider::TextBoxBelow, true, 80, 20);
+    frequencySliders[i].addListener (this);
+    addAndMakeVisible (frequencySliders[i]);
+
+    gainSliders[i].setSliderStyle (juce::Slider::LinearVertical);
+    gainSliders[i].setRange (-24.0f, 24.0f, 0.1f);
+    gainSliders[i].setValue (*audioProcessor.gainParams[i]);
+    gainSliders[i].setTextBoxStyle (juce::Slider::TextBoxBelow, true, 80, 20);
+    gainSliders[i].addListener (this);
+    addAndMakeVisible (gainSliders[i]);
+
+    
+    QSliders[i].setSliderStyle (juce::Slider::LinearVertical);
+    QSliders[i].setRange (0.1f, 10.0f, 0.1f);
+    QSliders[i].setValue (*audioProcessor.QParams[i]);
+    QSliders[i].setTextBoxStyle (juce::Slider::TextBoxBelow, true, 80, 20);
+    QSliders[i].addListener (this);
+    addAndMakeVisible (QSliders[i]);
+
+    typeComboBoxes[i].addItem ("Low Pass", 1);
+    typeComboBoxes[i].addItem ("High Pass", 2);
+    typeComboBoxes[i].addItem ("Band Pass", 3);
+    typeComboBoxes[i].addItem ("Notch", 4);
+    typeComboBoxes[i].addItem ("All Pass", 5);
+    typeComboBoxes[i].addItem ("Peak", 6);
+    typeComboBoxes[i].addItem ("Low Shelf", 7);
+    typeComboBoxes[i].addItem ("High Shelf", 8);
+    typeComboBoxes[i].setSelectedId (*audioProcessor.typeParams[i]);
+    typeComboBoxes[i].addListener (this);
+    addAndMakeVisible (typeComboBoxes[i]);
+}
+
+addChildComponent (analyzer);
+
+// Set up the layout
+resized();
+
+}
+
+JarEQAudioProcessorEditor::~JarEQAudioProcessorEditor()
+{
+}
+
+void JarEQAudioProcessorEditor::paint (juce::Graphics& g)
+{
+g.fillAll (juce::Colours::black);
+}
+
+void JarEQAudioProcessorEditor::resized()
+{
+int y = 10;
+// Title
+titleLabel.setBounds (10, y, 90, 30);
+telemetryLabel.setBounds (100, y + 5, getWidth() - 250, 20);
+undoButton.setBounds (getWidth() - 140, y + 5, 60, 20);
+redoButton.setBounds (getWidth() - 70, y + 5, 60, 20);
+y += 40;
+
+// Global gain
+globalGainLabel.setBounds (10, y, 80, 20);
+globalGainSlider.setBounds (100, y, getWidth() - 120, 20);
+y += 30;
+
+// Mix
+mixLabel.setBounds (10, y, 80, 20);
+mixSlider.setBounds (100, y, getWidth() - 120, 20);
+y += 30;
+
+// Bypass and analyzer buttons
+bypassButton.setBounds (10, y, 80, 20);
+analyzerButton.setBounds (100, y, 80, 20);
+storeAButton.setBounds (190, y, 60, 20);
+morphSlider.setBounds (260, y, getWidth() - 410, 20);
+clearMorphButton.setBounds (getWidth() - 140, y, 60, 20);
+storeBButton.setBounds (getWidth() - 70, y, 60, 20);
+y += 30;
+
+// Analyzer sits to the right of the filter bands
+analyzer.setBounds (290, y, getWidth() - 300, getHeight() - y - 10);
+
+// Filter bands
+for (int i = 0; i < audioProcessor.getNumFilterBands(); ++i)
+{
+    frequencyLabels[i].setBounds (10, y, 50, 20);
+    gainLabels[i].setBounds (70, y, 50, 20);
+    QLabels[i].setBounds (130, y, 50, 20);
+    typeLabels[i].setBounds (190, y, 50, 20);
+    frequencySliders[i].setBounds (10, y + 20, 50, 100);
+    gainSliders[i].setBounds (70, y + 20, 50, 100);
+    QSliders[i].setBounds (130, y + 20, 50, 100);
+    typeComboBoxes[i].setBounds (190, y + 20, 80, 20);
+    y += 130;
+}
+}
+
+void JarEQAudioProcessorEditor::timerCallback()
+{
+const auto telemetry = audioProcessor.getTelemetry().getSnapshot();
+
+if (telemetry.numBlocks == 0)
+{
+    telemetryLabel.setText ({}, juce::dontSendNotification);
+    return;
+}
+
+telemetryLabel.setText ("DSP " + juce::String (telemetry.getAverageLoad() * 100.0, 1) + "%, peak "
+                          + juce::String (telemetry.worstLoad * 100.0, 1) + "%, "
+                          + juce::String (telemetry.nearMisses) + " near misses, "
+                          + juce::String (telemetry.misses) + " missed",
+                        juce::dontSendNotification);
+telemetryLabel.setColour (juce::Label::textColourId, telemetry.misses > 0 ? juce::Colours::red
+                                                   : telemetry.nearMisses > 0 ? juce::Colours::orange
+                                                   : juce::Colours::grey);
+}
+
+void JarEQAudioProcessorEditor::sliderValueChanged (juce::Slider* slider)
+{
+    }
+
+void JarEQAudioProcessorEditor::buttonClicked (juce::Button* button)
+{
+if (button == &bypassButton)
+{
+audioProcessor.bypassed = !audioProcessor.bypassed;
+}
+else if (button == &analyzerButton)
+{
+audioProcessor.analyzerEnabled = !audioProcessor.analyzerEnabled;
+analyzer.setVisible (audioProcessor.analyzerEnabled);
+
+if (audioProcessor.analyzerEnabled)
+    analyzer.start();
+else
+    analyzer.stop();
+}
+}
+
+void JarEQAudioProcessorEditor::comboBoxChanged (juce::ComboBox* comboBox)
+{
+for (int i = 0; i < audioProcessor.getNumFilterBands(); ++i)
+{
+if (comboBox == &typeComboBoxes[i])
+{
+*audioProcessor.typeParams[i] = comboBox->getSelectedId();
+}
+}
+}
+
+// Analyzer class
+
+JarEQAnalyzer::JarEQAnalyzer (JarEQAudioProcessor& p, AnalyserScheduler& s)
+    : audioProcessor (p), scheduler (s)
+{
+setOpaque (true);
+addAndMakeVisible (spectrogram);
+
+for (auto* parameter : audioProcessor.getParameters())
+    parameter->addListener (this);
+
+audioProcessor.addListener (this);
+}
+
+JarEQAnalyzer::~JarEQAnalyzer()
+{
+for (auto* parameter : audioProcessor.getParameters())
+    parameter->removeListener (this);
+
+audioProcessor.removeListener (this);
+stop();
+}
+
+void JarEQAnalyzer::paint (juce::Graphics& g)
+{
+gridLayer.draw (g, *this, [this] (juce::Graphics& lg) { drawGrid (lg); });
+    g.setColour (juce::Colours::white);
+
+// Nothing to draw but the grid and curve once the analyser has been released
+auto* analyser = audioProcessor.getSpectrumAnalyserIfCreated();
+const auto sampleRate = analyser != nullptr ? analyser->getLatestFrame().sampleRate : 0.0;
+const auto numPixels = (int) scopeMins.size();
+
+if (sampleRate > 0.0 && numPixels > 0)
+{
+    // Exactly one min/max pair per pixel, whatever the zoom
+    analyser->getScope().render (scopeMins.data(), scopeMaxs.data(), numPixels, (juce::int64) (scopeSeconds * sampleRate));
+
+    auto centre = (float) waveformArea.getCentreY();
+    auto halfHeight = waveformArea.getHeight() / 2.0f;
+
+    for (int x = 0; x < numPixels; ++x)
+    {
+        auto top = centre - scopeMaxs[(size_t) x] * halfHeight;
+        auto bottom = centre - scopeMins[(size_t) x] * halfHeight;
+        g.drawVerticalLine (waveformArea.getX() + x, top, juce::jmax (top + 1.0f, bottom));
+    }
+}
+
+if (analyser != nullptr)
+    drawSpectrum (g, *analyser, spectrumArea.toFloat());
+
+responseLayer.draw (g, *this, [this] (juce::Graphics& lg) { drawResponseCurve (lg); });
+}
+
+void JarEQAnalyzer::drawGrid (juce::Graphics& g)
+{
+g.fillAll (juce::Colours::black);
+g.setFont (10.0f);
+
+// Scope centre line
+g.setColour (juce::Colours::darkgrey);
+g.drawHorizontalLine (waveformArea.getCentreY(), (float) waveformArea.getX(), (float) waveformArea.getRight());
+
+auto area = spectrumArea.toFloat();
+
+for (auto frequency : { 20.0f, 50.0f, 100.0f, 200.0f, 500.0f, 1000.0f, 2000.0f, 5000.0f, 10000.0f, 20000.0f })
+{
+    auto x = area.getX() + LogFrequencyMap::frequencyToProportion (frequency) * area.getWidth();
+    g.setColour (juce::Colours::darkgrey.withAlpha (0.6f));
+    g.drawVerticalLine (juce::roundToInt (x), area.getY(), area.getBottom());
+
+    g.setColour (juce::Colours::grey);
+    auto label = frequency >= 1000.0f ? juce::String (frequency / 1000.0f) + "k" : juce::String (frequency);
+    g.drawText (label, juce::Rectangle<float> (x + 2.0f, area.getBottom() - 12.0f, 30.0f, 12.0f), juce::Justification::centredLeft);
+}
+
+for (float decibels = -96.0f; decibels <= 12.0f; decibels += 12.0f)
+{
+    auto y = juce::jmap (decibels, -100.0f, 12.0f, area.getBottom(), area.getY());
+    g.setColour (juce::Colours::darkgrey.withAlpha (0.6f));
+    g.drawHorizontalLine (juce::roundToInt (y), area.getX(), area.getRight());
+
+    g.setColour (juce::Colours::grey);
+    g.drawText (juce::String ((int) decibels) + " dB", juce::Rectangle<float> (area.getX() + 2.0f, y - 12.0f, 40.0f, 12.0f), juce::Justification::centredLeft);
+}
+}
+
+void JarEQAnalyzer::drawResponseCurve (juce::Graphics& g)
+{
+auto area = spectrumArea.toFloat();
+auto num = (int) responseFrequencies.size();
+
+if (num == 0)
+    return;
+
+audioProcessor.getMagnitudeResponse (responseFrequencies.data(), responseDecibels.data(), num);
+
+juce::Path curve;
+
+for (int x = 0; x < num; ++x)
+{
+    auto y = juce::jmap (juce::jlimit (-24.0f, 24.0f, responseDecibels[(size_t) x]), -24.0f, 24.0f, area.getBottom(), area.getY());
+
+    if (x == 0)
+        curve.startNewSubPath (area.getX(), y);
+    else
+        curve.lineTo (area.getX() + (float) x, y);
+}
+
+g.setColour (juce::Colours::yellow);
+g.strokePath (curve, juce::PathStrokeType (2.0f));
+}
+
+void JarEQAnalyzer::parameterValueChanged (int, float)
+{
+// Host automation calls this on the audio thread, so only a flag is set here
+responseChanged = true;
+}
+
+void JarEQAnalyzer::audioProcessorChanged (juce::AudioProcessor*, const ChangeDetails& details)
+{
+if (details.parameterInfoChanged)
+    responseChanged = true;
+}
+
+void JarEQAnalyzer::mouseWheelMove (const juce::MouseEvent& e, const juce::MouseWheelDetails& wheel)
+{
+if (! waveformArea.contains (e.getPosition()))
+    return;
+
+// Zoom the scope between 10 ms and 30 s of history
+scopeSeconds = juce::jlimit (0.01, 30.0, scopeSeconds * std::pow (2.0, (double) -wheel.deltaY * 4.0));
+repaint (waveformArea);
+}
+
+void JarEQAnalyzer::drawSpectrum (juce::Graphics& g, const SpectrumAnalyser& analyser, juce::Rectangle<float> area)
+{
+const auto& frame = analyser.getLatestFrame();
+
+if (frame.post.empty() || frame.sampleRate <= 0.0 || area.isEmpty())
+    return;
+
+// One point per pixel column, looked up through the shared log-frequency axis
+auto makeTrace = [&] (const std::vector<float>& decibels, float minDecibels, float maxDecibels)
+{
+    juce::Path trace;
+
+    for (int x = 0; x < (int) area.getWidth(); ++x)
+    {
+        auto frequency = LogFrequencyMap::proportionToFrequency ((float) x / area.getWidth());
+        auto bin = juce::jlimit (0, SpectrumAnalyser::numBins - 1,
+                                 juce::roundToInt (LogFrequencyMap::frequencyToBin (frequency, SpectrumAnalyser::fftSize, frame.sampleRate)));
+        auto y = juce::jmap (juce::jlimit (minDecibels, maxDecibels, decibels[(size_t) bin]),
+                             minDecibels, maxDecibels, area.getBottom(), area.getY());
+
+        if (x == 0)
+            trace.startNewSubPath (area.getX(), y);
+        else
+            trace.lineTo (area.getX() + (float) x, y);
+    }
+
+    return trace;
+};
+
+g.setColour (juce::Colours::grey);
+g.strokePath (makeTrace (frame.pre, -100.0f, 12.0f), juce::PathStrokeType (1.0f));
+
+g.setColour (juce::Colours::lightblue);
+g.strokePath (makeTrace (frame.average, -100.0f, 12.0f), juce::PathStrokeType (1.0f));
+
+g.setColour (juce::Colours::orange);
+g.strokePath (makeTrace (frame.peak, -100.0f, 12.0f), juce::PathStrokeType (1.0f));
+
+g.setColour (juce::Colours::white);
+g.strokePath (makeTrace (frame.post, -100.0f, 12.0f), juce::PathStrokeType (1.5f));
+
+g.setColour (juce::Colours::limegreen);
+g.strokePath (makeTrace (frame.difference, -24.0f, 24.0f), juce::PathStrokeType (1.0f));
+}
+
+void JarEQAnalyzer::resized()
+{
+// Waveform on top, then the spectrum traces, with the spectrogram underneath
+auto bounds = getLocalBounds();
+spectrogram.setBounds (bounds.removeFromBottom (getHeight() / 2));
+waveformArea = bounds.removeFromTop (bounds.getHeight() / 3);
+spectrumArea = bounds;
+
+scopeMins.resize ((size_t) waveformArea.getWidth());
+scopeMaxs.resize ((size_t) waveformArea.getWidth());
+
+responseFrequencies.resize ((size_t) spectrumArea.getWidth());
+responseDecibels.resize ((size_t) spectrumArea.getWidth());
+
+for (size_t x = 0; x < responseFrequencies.size(); ++x)
+    responseFrequencies[x] = LogFrequencyMap::proportionToFrequency ((float) x / (float) spectrumArea.getWidth());
+
+gridLayer.invalidate();
+responseLayer.invalidate();
+}
+
+bool JarEQAnalyzer::pullNewFrame()
+{
+if (responseChanged.exchange (false))
+{
+    responseLayer.invalidate();
+    repaint (spectrumArea);
+}
+
+auto* analyser = audioProcessor.getSpectrumAnalyserIfCreated();
+
+if (analyser == nullptr || ! analyser->pullLatestFrame())
+    return false;
+
+const auto& frame = analyser->getLatestFrame();
+spectrogram.pushFrame (frame.post.data(), SpectrumAnalyser::numBins, frame.sampleRate);
+return true;
+}
+
+juce::Rectangle<int> JarEQAnalyzer::getDirtyArea()
+{
+// The spectrogram repaints itself when a column is pushed
+return waveformArea.getUnion (spectrumArea);
+}
+
+bool JarEQAnalyzer::isSignalPresent() const
+{
+auto* analyser = audioProcessor.getSpectrumAnalyserIfCreated();
+return analyser != nullptr && analyser->getLatestFrame().postLevel > juce::Decibels::decibelsToGain (-90.0f);
+}
+
+void JarEQAnalyzer::start()
+{
+audioProcessor.getSpectrumAnalyser();
+scheduler.addClient (this);
+}
+
+void JarEQAnalyzer::stop()
+{
+scheduler.removeClient (this);
+
+// The analyser's buffers are only kept while something is showing them
+audioProcessor.releaseSpectrumAnalyser();
+}
+
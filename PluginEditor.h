@@ -1,50 +1,118 @@
-// PluginEditor.h
-
-#pragma once
-
-#include <JuceHeader.h>
-#include "PluginProcessor.h"
-#include "Constants.h"
-
-class JarEQAudioProcessorEditor  : public juce::AudioProcessorEditor,
-                                   public juce::Slider::Listener,
-                                   public juce::Button::Listener,
-                                   public juce::ComboBox::Listener
-{
-public:
-    explicit JarEQAudioProcessorEditor (JarEQAudioProcessor&);
-    ~JarEQAudioProcessorEditor() override;
-
-    //==============================================================================
-    void paint (juce::Graphics&) override;
-    void resized() override;
-
-    void sliderValueChanged (juce::Slider* slider) override;
-    void buttonClicked (juce::Button* button) override;
-    void comboBoxChanged (juce::ComboBox* comboBox) override;
-
-private:
-    // Processor reference
-    JarEQAudioProcessor& audioProcessor;
-
-    // GUI components
-    juce::Label titleLabel;
-    juce::Label globalGainLabel;
-    juce::Slider globalGainSlider;
-    juce::Label mixLabel;
-    juce::Slider mixSlider;
-    juce::TextButton bypassButton;
-    juce::TextButton analyzerButton;
-
-    // Filter band parameters
-    std::array<juce::Slider, maxNumFilterBands> frequencySliders;
-    std::array<juce::Slider, maxNumFilterBands> gainSliders;
-    std::array<juce::Slider, maxNumFilterBands> QSliders;
-    std::array<juce::Label, maxNumFilterBands> frequencyLabels;
-    std::array<juce::Label, maxNumFilterBands> gainLabels;
-    std::array<juce::Label, maxNumFilterBands> QLabels;
-    std::array<juce::ComboBox, maxNumFilterBands> typeComboBoxes;
-    std::array<juce::Label, maxNumFilterBands> typeLabels;
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (JarEQAudioProcessorEditor)
-};
+// PluginEditor.h
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+#include "Constants.h"
+#include "Spectrogram.h"
+#include "AnalyserScheduler.h"
+#include "RenderLayer.h"
+
+//==============================================================================
+class JarEQAnalyzer  : public juce::Component,
+                       private AnalyserScheduler::Client,
+                       private juce::AudioProcessorParameter::Listener,
+                       private juce::AudioProcessorListener
+{
+public:
+    JarEQAnalyzer (JarEQAudioProcessor&, AnalyserScheduler&);
+    ~JarEQAnalyzer() override;
+
+    void paint (juce::Graphics&) override;
+    void resized() override;
+    void mouseWheelMove (const juce::MouseEvent&, const juce::MouseWheelDetails&) override;
+
+    void start();
+    void stop();
+
+private:
+    bool pullNewFrame() override;
+    juce::Component& getAnalyserComponent() override     { return *this; }
+    juce::Rectangle<int> getDirtyArea() override;
+    bool isSignalPresent() const override;
+
+    void parameterValueChanged (int parameterIndex, float newValue) override;
+    void parameterGestureChanged (int, bool) override {}
+
+    // Batched changes (presets, state loads) skip the per-parameter callbacks
+    void audioProcessorParameterChanged (juce::AudioProcessor*, int, float) override {}
+    void audioProcessorChanged (juce::AudioProcessor*, const ChangeDetails&) override;
+
+    void drawGrid (juce::Graphics&);
+    void drawResponseCurve (juce::Graphics&);
+    void drawSpectrum (juce::Graphics&, const SpectrumAnalyser&, juce::Rectangle<float> area);
+
+    JarEQAudioProcessor& audioProcessor;
+    AnalyserScheduler& scheduler;
+
+    juce::Rectangle<int> waveformArea, spectrumArea;
+
+    double scopeSeconds = 0.05;
+    std::vector<float> scopeMins, scopeMaxs;
+
+    // The grid only changes on resize and the response curve only on parameter
+    // changes, so both are cached; only the live traces are drawn every frame
+    RenderLayer gridLayer { true }, responseLayer { false };
+    std::vector<float> responseFrequencies, responseDecibels;
+
+    // Set from whichever thread changed a parameter, picked up on the scheduler's tick
+    std::atomic<bool> responseChanged { false };
+    SpectrogramComponent spectrogram;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (JarEQAnalyzer)
+};
+
+//==============================================================================
+class JarEQAudioProcessorEditor  : public juce::AudioProcessorEditor,
+                                   public juce::Slider::Listener,
+                                   public juce::Button::Listener,
+                                   public juce::ComboBox::Listener,
+                                   private juce::Timer
+{
+public:
+    explicit JarEQAudioProcessorEditor (JarEQAudioProcessor&);
+    ~JarEQAudioProcessorEditor() override;
+
+    //==============================================================================
+    void paint (juce::Graphics&) override;
+    void resized() override;
+
+    void sliderValueChanged (juce::Slider* slider) override;
+    void buttonClicked (juce::Button* button) override;
+    void comboBoxChanged (juce::ComboBox* comboBox) override;
+
+private:
+    void timerCallback() override;
+
+    // Processor reference
+    JarEQAudioProcessor& audioProcessor;
+
+    // GUI components
+    juce::Label titleLabel;
+    juce::Label telemetryLabel;
+    juce::Label globalGainLabel;
+    juce::Slider globalGainSlider;
+    juce::Label mixLabel;
+    juce::Slider mixSlider;
+    juce::TextButton bypassButton;
+    juce::TextButton analyzerButton;
+    juce::TextButton storeAButton, storeBButton, clearMorphButton;
+    juce::TextButton undoButton, redoButton;
+    juce::Slider morphSlider;
+
+    // Filter band parameters
+    std::array<juce::Slider, maxNumFilterBands> frequencySliders;
+    std::array<juce::Slider, maxNumFilterBands> gainSliders;
+    std::array<juce::Slider, maxNumFilterBands> QSliders;
+    std::array<juce::Label, maxNumFilterBands> frequencyLabels;
+    std::array<juce::Label, maxNumFilterBands> gainLabels;
+    std::array<juce::Label, maxNumFilterBands> QLabels;
+    std::array<juce::ComboBox, maxNumFilterBands> typeComboBoxes;
+    std::array<juce::Label, maxNumFilterBands> typeLabels;
+
+    AnalyserScheduler analyserScheduler;
+    JarEQAnalyzer analyzer;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (JarEQAudioProcessorEditor)
+};
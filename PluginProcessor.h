@@ -1,62 +1,252 @@
-/*
-  ==============================================================================
-
-    This file contains the basic framework code for a JUCE plugin processor.
-
-  ==============================================================================
-*/
-
-#pragma once
-
-#include <JuceHeader.h>
-
-//==============================================================================
-/**
-*/
-class JarEQAudioProcessor  : public juce::AudioProcessor
-                            #if JucePlugin_Enable_ARA
-                             , public juce::AudioProcessorARAExtension
-                            #endif
-{
-public:
-    //==============================================================================
-    JarEQAudioProcessor();
-    ~JarEQAudioProcessor() override;
-
-    //==============================================================================
-    void prepareToPlay (double sampleRate, int samplesPerBlock) override;
-    void releaseResources() override;
-
-   #ifndef JucePlugin_PreferredChannelConfigurations
-    bool isBusesLayoutSupported (const BusesLayout& layouts) const override;
-   #endif
-
-    void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
-
-    //==============================================================================
-    juce::AudioProcessorEditor* createEditor() override;
-    bool hasEditor() const override;
-
-    //==============================================================================
-    const juce::String getName() const override;
-
-    bool acceptsMidi() const override;
-    bool producesMidi() const override;
-    bool isMidiEffect() const override;
-    double getTailLengthSeconds() const override;
-
-    //==============================================================================
-    int getNumPrograms() override;
-    int getCurrentProgram() override;
-    void setCurrentProgram (int index) override;
-    const juce::String getProgramName (int index) override;
-    void changeProgramName (int index, const juce::String& newName) override;
-
-    //==============================================================================
-    void getStateInformation (juce::MemoryBlock& destData) override;
-    void setStateInformation (const void* data, int sizeInBytes) override;
-
-private:
-    //==============================================================================
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (JarEQAudioProcessor)
-};
+/*
+  ==============================================================================
+
+    This file contains the basic framework code for a JUCE plugin processor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SpectrumAnalyser.h"
+#include "StateCodec.h"
+#include "ParameterBatch.h"
+#include "PresetLibrary.h"
+#include "PresetMorph.h"
+#include "UndoHistory.h"
+#include "FilterBank.h"
+#include "ParameterEventQueue.h"
+#include "ProcessTelemetry.h"
+
+//==============================================================================
+/**
+*/
+class JarEQAudioProcessor  : public juce::AudioProcessor
+                            #if JucePlugin_Enable_ARA
+                             , public juce::AudioProcessorARAExtension
+                            #endif
+{
+public:
+    //==============================================================================
+    JarEQAudioProcessor();
+    ~JarEQAudioProcessor() override;
+
+    //==============================================================================
+    void prepareToPlay (double sampleRate, int samplesPerBlock) override;
+    void releaseResources() override;
+
+   #ifndef JucePlugin_PreferredChannelConfigurations
+    bool isBusesLayoutSupported (const BusesLayout& layouts) const override;
+   #endif
+
+    void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+
+    //==============================================================================
+    juce::AudioProcessorEditor* createEditor() override;
+    bool hasEditor() const override;
+
+    //==============================================================================
+    const juce::String getName() const override;
+
+    bool acceptsMidi() const override;
+    bool producesMidi() const override;
+    bool isMidiEffect() const override;
+    double getTailLengthSeconds() const override;
+
+    //==============================================================================
+    int getNumPrograms() override;
+    int getCurrentProgram() override;
+    void setCurrentProgram (int index) override;
+    const juce::String getProgramName (int index) override;
+    void changeProgramName (int index, const juce::String& newName) override;
+
+    //==============================================================================
+    void getStateInformation (juce::MemoryBlock& destData) override;
+    void setStateInformation (const void* data, int sizeInBytes) override;
+
+    //==============================================================================
+    /** Message thread: the analyser is created the first time something asks for it. */
+    SpectrumAnalyser& getSpectrumAnalyser();
+
+    /** Message thread: the analyser if it exists, without creating one. */
+    SpectrumAnalyser* getSpectrumAnalyserIfCreated() const noexcept  { return spectrumAnalyserStorage.get(); }
+
+    /** Message thread: frees the analyser and its buffers once nothing is showing it. */
+    void releaseSpectrumAnalyser();
+
+    //==============================================================================
+    /** Approximate heap and object bytes held by this instance. */
+    struct MemoryReport
+    {
+        size_t processor = 0, parameters = 0, filterBank = 0, smoothing = 0, analyser = 0, undoHistory = 0;
+
+        size_t getTotal() const noexcept    { return processor + parameters + filterBank + smoothing + analyser + undoHistory; }
+    };
+
+    MemoryReport getMemoryReport() const;
+
+    /** Fills the combined response of all bands, in decibels, at the given frequencies. */
+    void getMagnitudeResponse (const float* frequencies, float* magnitudesInDecibels, int num) const;
+
+    /** After prepareToPlay: how many samples of input it takes for the filter state
+        to forget everything before them, to within tolerance of full scale.
+    */
+    int getSettlingSamples (double tolerance) const;
+
+    /** A/B comparison: capture the current bands into a slot. Once both slots
+        are stored, the morph parameter sweeps the bands between them.
+    */
+    void storeMorphSnapshot (PresetMorph::Slot);
+    void clearMorphSnapshots();
+    bool isMorphActive() const noexcept                 { return presetMorph.isActive(); }
+
+    /** The morph position, 0 = A and 1 = B, for the editor's slider. */
+    juce::AudioParameterFloat& getMorphParameter() noexcept  { return *morphParam; }
+
+    UndoHistory& getUndoHistory() noexcept              { return undoHistory; }
+
+    /** Per-stage CPU use and deadline misses of processBlock, readable from any thread. */
+    ProcessTelemetry& getTelemetry() noexcept           { return telemetry; }
+
+    /** A parameter by its stable ID (see StateCodec.h), or nullptr if there's no such parameter. */
+    juce::RangedAudioParameter* getParameterByStableID (juce::uint16 stableID) const noexcept;
+
+    /** Parameter changes with known sample offsets can be pushed here directly. */
+    ParameterEventQueue& getParameterEventQueue() noexcept  { return parameterEvents; }
+
+    /** Applies a preset tree as written by PresetManager (a PRESET with FILTER children) in one batch. */
+    void applyPreset (const juce::ValueTree& preset);
+
+    /** A batch for changing many parameters at once, e.g. loading a preset. */
+    ParameterBatch createParameterBatch()                { return ParameterBatch (*this, parameterGeneration); }
+
+    //==============================================================================
+    /** Message thread: saves and recalls the bands as named presets in the user's
+        preset folder. Every instance shares one PresetLibrary for the folder.
+    */
+    class PresetManager
+    {
+    public:
+        explicit PresetManager (JarEQAudioProcessor&);
+
+        static juce::File getPresetDirectory();
+
+        /** For listening to changes in the preset list. */
+        PresetLibrary& getLibrary()                         { return getOrCreateLibrary(); }
+
+        void setCurrentPresetName (const juce::String& name);
+        const juce::String& getCurrentPresetName() const;
+
+        void savePreset (const juce::String& name);
+        void loadPreset (const juce::String& name);
+        void deletePreset (const juce::String& name);
+        void renamePreset (const juce::String& oldName, const juce::String& newName);
+
+        int getNumPresets() const;
+        juce::String getPresetName (int index) const;
+        int getCurrentPresetIndex() const;
+
+        void getNextPreset();
+        void getPreviousPreset();
+
+    private:
+        JarEQAudioProcessor& processor;
+
+        // Joined on first use, so processors that never touch presets never touch the disk
+        PresetLibrary& getOrCreateLibrary() const;
+        juce::SharedResourcePointer<SharedPresetLibraries> libraries;
+        mutable std::shared_ptr<PresetLibrary> library;
+        juce::String currentPresetName;
+
+        JUCE_DECLARE_NON_COPYABLE (PresetManager)
+    };
+
+    PresetManager& getPresetManager() noexcept           { return presetManager; }
+
+private:
+    //==============================================================================
+    std::unique_ptr<SpectrumAnalyser> spectrumAnalyserStorage;
+    std::atomic<SpectrumAnalyser*> spectrumAnalyser { nullptr };
+
+    // Bumped on entering and on leaving processBlock, so odd while a block runs
+    std::atomic<juce::uint32> processEpoch { 0 };
+
+    // Unpublished analysers a running block may still hold, freed once that block is over
+    struct RetiredAnalyser
+    {
+        std::unique_ptr<SpectrumAnalyser> analyser;
+        juce::uint32 epoch;
+    };
+
+    std::vector<RetiredAnalyser> retiredAnalysers;
+    bool freeRetiredAnalysers();
+
+    class RetiredAnalyserReaper  : private juce::Timer
+    {
+    public:
+        explicit RetiredAnalyserReaper (JarEQAudioProcessor& p) : processor (p) {}
+        void start()                                     { startTimer (50); }
+
+    private:
+        void timerCallback() override                    { if (processor.freeRetiredAnalysers()) stopTimer(); }
+
+        JarEQAudioProcessor& processor;
+    };
+
+    RetiredAnalyserReaper retiredAnalyserReaper { *this };
+    int preparedBlockSize = 0;
+    juce::AudioBuffer<float> dryBuffer;
+    ParameterTable parameterTable;
+
+    // Bumped by ParameterBatch; odd while a batch is being written
+    std::atomic<juce::uint32> parameterGeneration { 0 };
+
+    /** Makes the audio thread re-read every target on its next block, as a batch does. */
+    void forceResync() noexcept                          { parameterGeneration.fetch_add (2, std::memory_order_release); }
+    UndoHistory undoHistory { *this, parameterGeneration };
+
+    // Derived from the host's rate in prepareToPlay; nothing assumes 44.1 kHz
+    struct RateConstants
+    {
+        double sampleRate = 0.0;
+        float maxBandFrequency = 20000.0f;  // kept clear of Nyquist at low rates
+        int subBlockSize = 32;              // at most about 0.7 ms whatever the rate
+    };
+
+    RateConstants rateConstants;
+
+    // Band targets glide through the smoothers, redesigned once per sub-block
+    static constexpr double smoothingTimeSeconds = 0.02;
+    std::vector<BandSmoother> bandSmoothers;
+    FilterBank filterBank;
+    juce::SharedResourcePointer<SharedCoefficientTables> coefficientTables;
+    // Swapped in prepareToPlay while the editor may be reading it: std::atomic_load/atomic_store
+    // everywhere except the audio thread, which never runs alongside prepareToPlay
+    std::shared_ptr<const PeakDesignTable> peakDesignTable;
+    PresetMorph presetMorph;
+    std::unique_ptr<juce::AudioParameterFloat> morphParam;
+
+    // Not for the audio thread: waits for the morph snapshots if they are being stored
+    BandSettings getBandTarget (int band) const noexcept;
+
+    // Sample-accurate automation: the audio thread's own view of every parameter,
+    // advanced through the block's queued events in sample order
+    static constexpr int minimumEventSubBlockSize = 16;
+    ParameterEventQueue parameterEvents;
+    std::vector<ParameterEventQueue::Event> blockEvents;
+    std::vector<float> automationValues, syncedValues;
+    juce::uint32 lastSyncedGeneration = 0;
+    bool resyncPending = false;
+
+    // Reads every parameter as of the given (even) generation; false, changing nothing, if a batch got in the way
+    bool syncAutomationValues (juce::uint32 generation) noexcept;
+    // False if the morph snapshots were being stored, in which case the old target stands
+    bool getAutomatedBandTarget (int band, BandSettings& target) const noexcept;
+    void processFilters (juce::AudioBuffer<float>&, int startSample, int numSamples, ProcessTelemetry::Block&);
+
+    ProcessTelemetry telemetry;
+    PresetManager presetManager { *this };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (JarEQAudioProcessor)
+};
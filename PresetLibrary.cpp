@@ -0,0 +1,428 @@
+/*
+  ==============================================================================
+
+    PresetLibrary.cpp
+    Created: 19 Oct 2026 9:50:31am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "PresetLibrary.h"
+
+namespace
+{
+    // Catalog layout, all little-endian:
+    //   header  { uint32 magic, uint16 version, uint16 reserved, uint32 count }
+    //   records { int64 modificationTime, int64 fileSize, uint32 nameOffset, uint32 nameBytes } x count
+    //   UTF-8 name pool
+    constexpr juce::uint32 catalogMagic = 0x4351454a;   // "JEQC"
+    constexpr juce::uint16 catalogVersion = 1;
+    constexpr size_t catalogHeaderSize = 12;
+    constexpr size_t catalogRecordSize = 24;
+}
+
+//==============================================================================
+PresetLibrary::PresetLibrary (const juce::File& presetDirectory)
+    : juce::Thread ("JarEQ preset scanner"),
+      directory (presetDirectory),
+      catalogFile (presetDirectory.getChildFile (catalogFileName))
+{
+    directory.createDirectory();
+    readCatalog();
+    startThread (juce::Thread::Priority::background);
+}
+
+PresetLibrary::~PresetLibrary()
+{
+    stopThread (4000);
+
+    if (catalogDirty.exchange (false))
+        writeCatalog();
+}
+
+void PresetLibrary::rescan()
+{
+    rescanRequested = true;
+    notify();
+}
+
+//==============================================================================
+int PresetLibrary::getNumPresets() const
+{
+    const juce::ScopedLock sl (lock);
+    return (int) entries.size();
+}
+
+bool PresetLibrary::contains (const juce::String& name) const
+{
+    const juce::ScopedLock sl (lock);
+    return index.contains (name);
+}
+
+juce::StringArray PresetLibrary::getPresetNames() const
+{
+    const juce::ScopedLock sl (lock);
+    return getSortedNames();
+}
+
+juce::String PresetLibrary::getPresetName (int sortedIndex) const
+{
+    const juce::ScopedLock sl (lock);
+    return getSortedNames()[sortedIndex];
+}
+
+int PresetLibrary::indexOfPreset (const juce::String& name) const
+{
+    const juce::ScopedLock sl (lock);
+
+    if (! index.contains (name))
+        return -1;
+
+    return getSortedNames().indexOf (name);
+}
+
+juce::File PresetLibrary::getFileFor (const juce::String& name) const
+{
+    jassert (isValidName (name));
+    return directory.getChildFile (name + presetExtension);
+}
+
+bool PresetLibrary::isValidName (const juce::String& name)
+{
+    return name.trim().isNotEmpty()
+        && name == name.trim()
+        && juce::File::createLegalFileName (name) == name;
+}
+
+bool PresetLibrary::canTakeName (const juce::String& name, const juce::String& replacing) const
+{
+    if (! isValidName (name))
+        return false;
+
+    // Case-insensitive file systems would put both names in one file
+    const juce::ScopedLock sl (lock);
+
+    for (auto& entry : entries)
+        if (entry.name != name && entry.name != replacing && entry.name.equalsIgnoreCase (name))
+            return false;
+
+    return true;
+}
+
+//==============================================================================
+juce::ValueTree PresetLibrary::loadPreset (const juce::String& name) const
+{
+    if (! isValidName (name) || ! contains (name))
+        return {};
+
+    if (auto xml = juce::parseXML (getFileFor (name)))
+        return juce::ValueTree::fromXml (*xml);
+
+    return {};
+}
+
+bool PresetLibrary::savePreset (const juce::String& name, const juce::ValueTree& preset)
+{
+    if (! canTakeName (name, {}))
+        return false;
+
+    auto file = getFileFor (name);
+    auto xml = preset.createXml();
+
+    if (xml == nullptr || ! xml->writeTo (file))
+        return false;
+
+    {
+        const juce::ScopedLock sl (lock);
+        auto entry = makeEntry (file);
+        entry.name = name;
+        setEntry (entry);
+    }
+
+    listChanged();
+    return true;
+}
+
+bool PresetLibrary::deletePreset (const juce::String& name)
+{
+    if (! isValidName (name) || ! getFileFor (name).deleteFile())
+        return false;
+
+    {
+        const juce::ScopedLock sl (lock);
+        removeEntry (name);
+    }
+
+    listChanged();
+    return true;
+}
+
+bool PresetLibrary::renamePreset (const juce::String& oldName, const juce::String& newName)
+{
+    if (! contains (oldName) || ! canTakeName (newName, oldName))
+        return false;
+
+    auto target = getFileFor (newName);
+
+    if ((target.exists() && ! newName.equalsIgnoreCase (oldName)) || ! getFileFor (oldName).moveFileTo (target))
+        return false;
+
+    {
+        const juce::ScopedLock sl (lock);
+        removeEntry (oldName);
+
+        auto entry = makeEntry (target);
+        entry.name = newName;
+        setEntry (entry);
+    }
+
+    listChanged();
+    return true;
+}
+
+//==============================================================================
+void PresetLibrary::run()
+{
+    bool scan = true;
+
+    while (! threadShouldExit())
+    {
+        if (scan)
+        {
+            std::vector<Entry> found;
+
+            if (scanDirectory (found) && merge (found))
+                sendChangeMessage();
+        }
+
+        if (catalogDirty.exchange (false))
+            writeCatalog();
+
+        // Periodic rescans catch presets copied in from outside; a signal
+        // without a rescan request is just a catalog flush after a save
+        const bool signalled = wait (rescanIntervalMs);
+        scan = ! signalled || rescanRequested.exchange (false);
+    }
+}
+
+bool PresetLibrary::scanDirectory (std::vector<Entry>& found)
+{
+    for (const auto& file : juce::RangedDirectoryIterator (directory, false, juce::String ("*") + presetExtension,
+                                                           juce::File::findFiles))
+    {
+        if (threadShouldExit())
+            return false;
+
+        // A file named outside JarEQ may not round-trip through a name; leave it alone
+        if (! isValidName (file.getFile().getFileNameWithoutExtension()))
+            continue;
+
+        found.push_back ({ file.getFile().getFileNameWithoutExtension(),
+                           file.getModificationTime().toMilliseconds(),
+                           file.getFileSize() });
+    }
+
+    return true;
+}
+
+bool PresetLibrary::merge (std::vector<Entry>& found)
+{
+    bool changed = false;
+
+    const juce::ScopedLock sl (lock);
+
+    juce::HashMap<juce::String, int> seen;
+
+    for (auto& entry : found)
+    {
+        seen.set (entry.name, 1);
+
+        if (index.contains (entry.name))
+        {
+            const auto& existing = entries[(size_t) index[entry.name]];
+
+            if (existing.modificationTime == entry.modificationTime && existing.fileSize == entry.fileSize)
+                continue;
+        }
+
+        setEntry (entry);
+        changed = true;
+    }
+
+    // Anything the scan didn't see has gone, unless it was saved while the scan was running
+    for (int i = (int) entries.size(); --i >= 0;)
+    {
+        const auto name = entries[(size_t) i].name;
+
+        if (! seen.contains (name) && ! getFileFor (name).existsAsFile())
+        {
+            removeEntry (name);
+            changed = true;
+        }
+    }
+
+    if (changed)
+        catalogDirty = true;
+
+    return changed;
+}
+
+//==============================================================================
+void PresetLibrary::readCatalog()
+{
+    juce::MemoryMappedFile mapped (catalogFile, juce::MemoryMappedFile::readOnly);
+    auto* data = static_cast<const char*> (mapped.getData());
+    const auto size = mapped.getSize();
+
+    if (data == nullptr || size < catalogHeaderSize
+         || juce::ByteOrder::littleEndianInt (data) != catalogMagic
+         || juce::ByteOrder::littleEndianShort (data + 4) != catalogVersion)
+        return;
+
+    const auto count = (size_t) juce::ByteOrder::littleEndianInt (data + 8);
+    const auto poolStart = catalogHeaderSize + count * catalogRecordSize;
+
+    if (poolStart > size)
+        return;
+
+    const juce::ScopedLock sl (lock);
+    entries.reserve (count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto* record = data + catalogHeaderSize + i * catalogRecordSize;
+        const auto nameOffset = (size_t) juce::ByteOrder::littleEndianInt (record + 16);
+        const auto nameBytes = (size_t) juce::ByteOrder::littleEndianInt (record + 20);
+
+        if (poolStart + nameOffset + nameBytes > size)
+            break;
+
+        const auto name = juce::String::fromUTF8 (data + poolStart + nameOffset, (int) nameBytes);
+
+        // Older catalogs could hold names that were mangled on the way to a file name
+        if (! isValidName (name))
+            continue;
+
+        setEntry ({ name,
+                    (juce::int64) juce::ByteOrder::littleEndianInt64 (record),
+                    (juce::int64) juce::ByteOrder::littleEndianInt64 (record + 8) });
+    }
+}
+
+void PresetLibrary::writeCatalog()
+{
+    juce::MemoryOutputStream records, names;
+
+    {
+        const juce::ScopedLock sl (lock);
+
+        for (auto& entry : entries)
+        {
+            const auto utf8 = entry.name.toUTF8();
+            const auto numBytes = utf8.sizeInBytes() - 1;
+
+            records.writeInt64 (entry.modificationTime);
+            records.writeInt64 (entry.fileSize);
+            records.writeInt ((int) names.getDataSize());
+            records.writeInt ((int) numBytes);
+            names.write (utf8.getAddress(), numBytes);
+        }
+    }
+
+    juce::TemporaryFile temp (catalogFile);
+
+    if (auto out = temp.getFile().createOutputStream())
+    {
+        out->writeInt ((int) catalogMagic);
+        out->writeShort ((short) catalogVersion);
+        out->writeShort (0);
+        out->writeInt ((int) (records.getDataSize() / catalogRecordSize));
+        out->write (records.getData(), records.getDataSize());
+        out->write (names.getData(), names.getDataSize());
+        out.reset();
+
+        temp.overwriteTargetFileWithTemporary();
+    }
+}
+
+//==============================================================================
+void PresetLibrary::setEntry (const Entry& entry)
+{
+    if (index.contains (entry.name))
+    {
+        entries[(size_t) index[entry.name]] = entry;
+        return;
+    }
+
+    index.set (entry.name, (int) entries.size());
+    entries.push_back (entry);
+    sortedNamesValid = false;
+}
+
+void PresetLibrary::removeEntry (const juce::String& name)
+{
+    if (! index.contains (name))
+        return;
+
+    // Swap the last entry into the hole so nothing else has to move
+    const auto position = index[name];
+    index.remove (name);
+
+    if (position != (int) entries.size() - 1)
+    {
+        entries[(size_t) position] = std::move (entries.back());
+        index.set (entries[(size_t) position].name, position);
+    }
+
+    entries.pop_back();
+    sortedNamesValid = false;
+}
+
+const juce::StringArray& PresetLibrary::getSortedNames() const
+{
+    if (! sortedNamesValid)
+    {
+        sortedNames.clearQuick();
+        sortedNames.ensureStorageAllocated ((int) entries.size());
+
+        for (auto& entry : entries)
+            sortedNames.add (entry.name);
+
+        sortedNames.sortNatural();
+        sortedNamesValid = true;
+    }
+
+    return sortedNames;
+}
+
+PresetLibrary::Entry PresetLibrary::makeEntry (const juce::File& file) const
+{
+    return { file.getFileNameWithoutExtension(),
+             file.getLastModificationTime().toMilliseconds(),
+             file.getSize() };
+}
+
+void PresetLibrary::listChanged()
+{
+    catalogDirty = true;
+    notify();
+    sendChangeMessage();
+}
+
+//==============================================================================
+std::shared_ptr<PresetLibrary> SharedPresetLibraries::getLibrary (const juce::File& presetDirectory)
+{
+    const juce::ScopedLock sl (lock);
+    const auto key = presetDirectory.getFullPathName();
+
+    if (auto existing = libraries[key].lock())
+        return existing;
+
+    for (auto it = libraries.begin(); it != libraries.end();)
+        it = it->second.expired() && it->first != key ? libraries.erase (it) : std::next (it);
+
+    auto library = std::make_shared<PresetLibrary> (presetDirectory);
+    libraries[key] = library;
+    return library;
+}
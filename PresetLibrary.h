@@ -0,0 +1,126 @@
+/*
+  ==============================================================================
+
+    PresetLibrary.h
+    Created: 19 Oct 2026 9:50:31am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    The presets in one folder, one file per preset, with a name index.
+
+    A catalog file in the folder keeps each preset's name, size and modification
+    time. It is memory-mapped and read when the library is created, so the browser
+    has the full list straight away, before the folder has been touched. A
+    background thread then scans the folder and picks up files added, changed
+    or removed elsewhere. It also flushes the catalog after changes.
+
+    Save, rename and delete only touch the preset's own file and update the
+    index in place. A ChangeMessage is sent whenever the list changes.
+
+    A preset's name is its file name, so the scan always finds a preset under
+    the name it was saved with. Names that aren't already legal file names, or
+    that differ from an existing preset only in case, are refused.
+*/
+class PresetLibrary  : public juce::ChangeBroadcaster,
+                       private juce::Thread
+{
+public:
+    struct Entry
+    {
+        juce::String name;
+        juce::int64 modificationTime = 0;
+        juce::int64 fileSize = 0;
+    };
+
+    static constexpr const char* presetExtension = ".jeqpreset";
+    static constexpr const char* catalogFileName = "presets.jeqcatalog";
+
+    explicit PresetLibrary (const juce::File& presetDirectory);
+    ~PresetLibrary() override;
+
+    /** Asks the scanner to re-read the folder now rather than at its next interval. */
+    void rescan();
+
+    //==============================================================================
+    int getNumPresets() const;
+    bool contains (const juce::String& name) const;
+
+    /** All preset names, sorted for display. */
+    juce::StringArray getPresetNames() const;
+
+    /** A name by its position in getPresetNames(), or an empty string. */
+    juce::String getPresetName (int sortedIndex) const;
+
+    /** The name's position in getPresetNames(), or -1. */
+    int indexOfPreset (const juce::String& name) const;
+
+    juce::File getFileFor (const juce::String& name) const;
+
+    /** True if the name can be saved as is: not empty, and a legal file name without changes. */
+    static bool isValidName (const juce::String& name);
+
+    //==============================================================================
+    /** Returns an invalid tree if the preset doesn't exist or can't be parsed. */
+    juce::ValueTree loadPreset (const juce::String& name) const;
+
+    bool savePreset (const juce::String& name, const juce::ValueTree& preset);
+    bool deletePreset (const juce::String& name);
+    bool renamePreset (const juce::String& oldName, const juce::String& newName);
+
+private:
+    static constexpr int rescanIntervalMs = 30000;
+
+    void run() override;
+
+    void readCatalog();
+    void writeCatalog();
+    bool scanDirectory (std::vector<Entry>& found);
+    bool merge (std::vector<Entry>& found);
+
+    // These expect the lock to be held
+    void setEntry (const Entry&);
+    void removeEntry (const juce::String& name);
+    const juce::StringArray& getSortedNames() const;
+
+    Entry makeEntry (const juce::File&) const;
+    bool canTakeName (const juce::String& name, const juce::String& replacing) const;
+    void listChanged();
+
+    juce::File directory, catalogFile;
+
+    mutable juce::CriticalSection lock;
+    std::vector<Entry> entries;
+    juce::HashMap<juce::String, int> index;   // name -> position in entries
+
+    // Rebuilt on the first read after a name is added or removed
+    mutable juce::StringArray sortedNames;
+    mutable bool sortedNamesValid = false;
+
+    std::atomic<bool> rescanRequested { false }, catalogDirty { false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PresetLibrary)
+};
+
+//==============================================================================
+/** One PresetLibrary per folder for every JarEQ instance in the process, so a
+    session full of instances shares one index and one scanner thread. Hold it
+    through juce::SharedResourcePointer; a library is freed once no instance
+    uses its folder.
+*/
+class SharedPresetLibraries
+{
+public:
+    std::shared_ptr<PresetLibrary> getLibrary (const juce::File& presetDirectory);
+
+private:
+    juce::CriticalSection lock;
+    std::map<juce::String, std::weak_ptr<PresetLibrary>> libraries;
+};
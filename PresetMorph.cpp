@@ -0,0 +1,138 @@
+/*
+  ==============================================================================
+
+    PresetMorph.cpp
+    Created: 19 Oct 2026 9:51:51am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "PresetMorph.h"
+
+//==============================================================================
+void PresetMorph::setNumBands (int numBands)
+{
+    const juce::SpinLock::ScopedLockType sl (lock);
+
+    for (auto& snapshot : snapshots)
+        snapshot.resize ((size_t) numBands);
+}
+
+void PresetMorph::store (Slot slot, const std::vector<BandSettings>& bands)
+{
+    auto& snapshot = snapshots[slotIndex (slot)];
+
+    {
+        const juce::SpinLock::ScopedLockType sl (lock);
+        jassert (bands.size() == snapshot.size());
+        std::copy_n (bands.begin(), juce::jmin (bands.size(), snapshot.size()), snapshot.begin());
+    }
+
+    stored[slotIndex (slot)] = true;
+}
+
+void PresetMorph::clear()
+{
+    for (auto& flag : stored)
+        flag = false;
+}
+
+bool PresetMorph::interpolate (int band, float position, BandSettings& result) const noexcept
+{
+    const juce::SpinLock::ScopedTryLockType sl (lock);
+
+    if (! sl.isLocked() || ! juce::isPositiveAndBelow (band, (int) snapshots[0].size()))
+        return false;
+
+    const auto& a = snapshots[0][(size_t) band];
+    const auto& b = snapshots[1][(size_t) band];
+    const auto t = juce::jlimit (0.0f, 1.0f, position);
+
+    result.frequency = a.frequency * std::pow (b.frequency / a.frequency, t);
+    result.Q = a.Q * std::pow (b.Q / a.Q, t);
+    result.gain = a.gain + (b.gain - a.gain) * t;
+    result.type = t < 0.5f ? a.type : b.type;
+
+    return true;
+}
+
+//==============================================================================
+void PresetMorph::appendTo (juce::MemoryBlock& state) const
+{
+    std::array<std::vector<BandSettings>, 2> copies;
+    int storedMask = 0;
+
+    {
+        const juce::SpinLock::ScopedLockType sl (lock);
+
+        for (size_t i = 0; i < copies.size(); ++i)
+        {
+            if (stored[i])
+            {
+                copies[i] = snapshots[i];
+                storedMask |= 1 << i;
+            }
+        }
+    }
+
+    if (storedMask == 0)
+        return;
+
+    // { uint32 magic, uint16 numBands, uint16 storedMask } then { frequency, gain, Q, type } per band per stored slot
+    juce::MemoryOutputStream out (state, true);
+    out.writeInt ((int) stateMagic);
+    out.writeShort ((short) snapshots[0].size());
+    out.writeShort ((short) storedMask);
+
+    for (auto& bands : copies)
+    {
+        for (auto& band : bands)
+        {
+            out.writeFloat (band.frequency);
+            out.writeFloat (band.gain);
+            out.writeFloat (band.Q);
+            out.writeInt (band.type);
+        }
+    }
+}
+
+void PresetMorph::restoreFrom (const void* data, size_t numBytes)
+{
+    clear();
+
+    if (data == nullptr || numBytes < 8)
+        return;
+
+    juce::MemoryInputStream in (data, numBytes, false);
+
+    if ((juce::uint32) in.readInt() != stateMagic)
+        return;
+
+    const auto numBands = (size_t) (juce::uint16) in.readShort();
+    const auto storedMask = (int) (juce::uint16) in.readShort();
+
+    if (numBands != snapshots[0].size())
+        return;
+
+    std::vector<BandSettings> bands (numBands);
+
+    for (auto slot : { Slot::A, Slot::B })
+    {
+        if ((storedMask & (1 << slotIndex (slot))) == 0)
+            continue;
+
+        if (in.getNumBytesRemaining() < (juce::int64) (numBands * 16))
+            return;
+
+        for (auto& band : bands)
+        {
+            band.frequency = in.readFloat();
+            band.gain = in.readFloat();
+            band.Q = in.readFloat();
+            band.type = in.readInt();
+        }
+
+        store (slot, bands);
+    }
+}
@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    PresetMorph.h
+    Created: 19 Oct 2026 9:51:51am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "BandSmoother.h"
+
+//==============================================================================
+/**
+    Two stored EQ snapshots (A and B) and the interpolation between them.
+
+    Snapshots are stored on the message thread. The audio thread reads them
+    with interpolate(), which blends one band in a handful of operations. Frequency
+    and Q are blended on a log scale and gain linearly in dB. The filter
+    type switches halfway. If the snapshots are being replaced at that
+    moment, interpolate() returns false and the caller keeps its current
+    targets.
+*/
+class PresetMorph
+{
+public:
+    enum class Slot
+    {
+        A,
+        B
+    };
+
+    void setNumBands (int numBands);
+
+    /** Message thread: replaces a slot's snapshot. */
+    void store (Slot, const std::vector<BandSettings>& bands);
+    void clear();
+
+    /** Message thread: appends the stored slots to a state blob. Nothing is written if
+        neither slot is stored.
+    */
+    void appendTo (juce::MemoryBlock& state) const;
+
+    /** Message thread: restores the slots from data written by appendTo(). Anything
+        else, including no data at all, leaves both slots empty.
+    */
+    void restoreFrom (const void* data, size_t numBytes);
+
+    bool hasSnapshot (Slot slot) const noexcept         { return stored[slotIndex (slot)].load(); }
+
+    /** True once both slots hold a snapshot. */
+    bool isActive() const noexcept                      { return hasSnapshot (Slot::A) && hasSnapshot (Slot::B); }
+
+    /** Audio thread: fills one band at the given morph position, 0 = A and 1 = B. */
+    bool interpolate (int band, float position, BandSettings& result) const noexcept;
+
+private:
+    static constexpr juce::uint32 stateMagic = 0x4d51454a;     // "JEQM"
+
+    static size_t slotIndex (Slot slot) noexcept        { return slot == Slot::A ? 0 : 1; }
+
+    std::array<std::vector<BandSettings>, 2> snapshots;
+    std::array<std::atomic<bool>, 2> stored { { false, false } };
+    mutable juce::SpinLock lock;
+};
@@ -0,0 +1,387 @@
+/*
+  ==============================================================================
+
+    ProcessBenchmark.cpp
+    Created: 19 Oct 2026 10:09:02am
+    Author:  jarre
+
+    Console target that times the processing path over a matrix of
+    configurations and reports ns/sample, cycles/sample and x-realtime.
+
+    Usage: ProcessBenchmark [--engine processor|library|all] [--bands 1,4,10]
+                            [--blocks 16,64,...] [--channels 1,2] [--rates 44100,...]
+                            [--events 0,1,16] [--seconds 2] [--repeats 5]
+                            [--json <file or ->]
+
+    "processor" is JarEQAudioProcessor::processBlock, the plugin's real path:
+    always stereo, every band always runs, and --bands sets how many of them
+    are non-flat. --events pushes that many sample-accurate automation events
+    into each block, which makes the bands glide. "library" is the JarEQDsp
+    cascade with exactly --bands bands and --channels channels.
+
+    The input is seeded noise and each figure is the median of the repeats
+    after a warm-up pass, so runs on the same machine are comparable. Times
+    are per sample frame (all channels together) and include refreshing the
+    block's input. Cycles come from the time-stamp counter on x86 and are
+    null elsewhere.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+#include "Constants.h"
+#include "JarEQDsp.h"
+
+#if JUCE_INTEL
+ #if JUCE_MSVC
+  #include <intrin.h>
+ #else
+  #include <x86intrin.h>
+ #endif
+#endif
+
+namespace
+{
+    struct Config
+    {
+        juce::String engine;
+        int bands, blockSize, channels;
+        double sampleRate;
+        int eventsPerBlock;
+    };
+
+    struct Measurement
+    {
+        double nsPerSample = 0.0, cyclesPerSample = -1.0, realtime = 0.0;
+    };
+
+    juce::uint64 readCycleCounter() noexcept
+    {
+       #if JUCE_INTEL
+        return (juce::uint64) __rdtsc();
+       #else
+        return 0;
+       #endif
+    }
+
+    /** One way of processing a block in place. */
+    class Engine
+    {
+    public:
+        virtual ~Engine() = default;
+        virtual void process (juce::AudioBuffer<float>&, int blockIndex) = 0;
+    };
+
+    // Bands spread over the spectrum, alternating boost and cut
+    void getBandSettings (int band, float& frequency, float& Q, float& gain)
+    {
+        frequency = 50.0f * std::pow (300.0f, (float) band / (float) juce::jmax (1, maxNumFilterBands - 1));
+        Q = 0.7f + 0.35f * (float) band;
+        gain = (band % 2 == 0 ? 6.0f : -6.0f);
+    }
+
+    juce::RangedAudioParameter& getBandParameter (JarEQAudioProcessor& processor, int band, StableParameterID::BandField field)
+    {
+        auto* parameter = processor.getParameterByStableID (StableParameterID::forBand (band, field));
+        jassert (parameter != nullptr);
+        return *parameter;
+    }
+
+    void setPlainValue (juce::RangedAudioParameter& parameter, float value)
+    {
+        parameter.setValueNotifyingHost (parameter.convertTo0to1 (value));
+    }
+
+    class ProcessorEngine  : public Engine
+    {
+    public:
+        explicit ProcessorEngine (const Config& c) : config (c)
+        {
+            processor.setPlayConfigDetails (2, 2, config.sampleRate, config.blockSize);
+
+            for (int band = 0; band < maxNumFilterBands; ++band)
+            {
+                float frequency, Q, gain;
+                getBandSettings (band, frequency, Q, gain);
+
+                setPlainValue (getBandParameter (processor, band, StableParameterID::frequency), frequency);
+                setPlainValue (getBandParameter (processor, band, StableParameterID::Q), Q);
+                setPlainValue (getBandParameter (processor, band, StableParameterID::gain), band < config.bands ? gain : 0.0f);
+            }
+
+            processor.prepareToPlay (config.sampleRate, config.blockSize);
+        }
+
+        ~ProcessorEngine() override
+        {
+            processor.releaseResources();
+        }
+
+        void process (juce::AudioBuffer<float>& block, int blockIndex) override
+        {
+            // Sweep the active bands' frequencies back and forth, one event per slot
+            auto& queue = processor.getParameterEventQueue();
+
+            for (int i = 0; i < config.eventsPerBlock; ++i)
+            {
+                auto& parameter = getBandParameter (processor, i % juce::jmax (1, config.bands), StableParameterID::frequency);
+                const auto value = ((blockIndex + i) % 2 == 0) ? 0.3f : 0.35f;
+
+                queue.push (parameter.getParameterIndex(), i * block.getNumSamples() / config.eventsPerBlock, value);
+            }
+
+            processor.processBlock (block, midi);
+        }
+
+    private:
+        Config config;
+        JarEQAudioProcessor processor;
+        juce::MidiBuffer midi;
+    };
+
+    class LibraryEngine  : public Engine
+    {
+    public:
+        explicit LibraryEngine (const Config& config)
+            : dsp (jareq_dsp_create (config.bands, config.channels, config.sampleRate))
+        {
+            for (int band = 0; band < config.bands; ++band)
+            {
+                float frequency, Q, gain;
+                getBandSettings (band, frequency, Q, gain);
+                jareq_dsp_set_band (dsp, band, frequency, Q, gain);
+            }
+        }
+
+        ~LibraryEngine() override
+        {
+            jareq_dsp_destroy (dsp);
+        }
+
+        void process (juce::AudioBuffer<float>& block, int) override
+        {
+            jareq_dsp_process_planar (dsp, block.getArrayOfWritePointers(), block.getNumChannels(), 0, block.getNumSamples());
+        }
+
+    private:
+        JarEQDsp* dsp;
+    };
+
+    Measurement measure (const Config& config, double secondsOfAudio, int repeats)
+    {
+        std::unique_ptr<Engine> engine;
+
+        if (config.engine == "processor")
+            engine = std::make_unique<ProcessorEngine> (config);
+        else
+            engine = std::make_unique<LibraryEngine> (config);
+
+        // One second of seeded noise at -12 dBFS, fed through block by block
+        const auto sourceLength = juce::jmax (config.blockSize, (int) config.sampleRate);
+        juce::AudioBuffer<float> source (config.channels, sourceLength);
+        juce::Random random (0x4a4551);
+
+        for (int channel = 0; channel < config.channels; ++channel)
+            for (int i = 0; i < sourceLength; ++i)
+                source.setSample (channel, i, (random.nextFloat() * 2.0f - 1.0f) * 0.25f);
+
+        juce::AudioBuffer<float> block (config.channels, config.blockSize);
+        const auto blocksPerSource = sourceLength / config.blockSize;
+        const auto numBlocks = juce::jmax (16, (int) std::ceil (secondsOfAudio * config.sampleRate / config.blockSize));
+
+        auto run = [&] (int count)
+        {
+            for (int b = 0; b < count; ++b)
+            {
+                const auto offset = (b % blocksPerSource) * config.blockSize;
+
+                for (int channel = 0; channel < config.channels; ++channel)
+                    block.copyFrom (channel, 0, source, channel, offset, config.blockSize);
+
+                engine->process (block, b);
+            }
+        };
+
+        run (juce::jmax (4, numBlocks / 4));
+
+        std::vector<double> seconds, cycles;
+
+        for (int r = 0; r < repeats; ++r)
+        {
+            const auto startCycles = readCycleCounter();
+            const auto startTicks = juce::Time::getHighResolutionTicks();
+
+            run (numBlocks);
+
+            const auto endTicks = juce::Time::getHighResolutionTicks();
+            const auto endCycles = readCycleCounter();
+
+            seconds.push_back (juce::Time::highResolutionTicksToSeconds (endTicks - startTicks));
+            cycles.push_back ((double) (endCycles - startCycles));
+        }
+
+        auto median = [] (std::vector<double>& values)
+        {
+            std::sort (values.begin(), values.end());
+            return values[values.size() / 2];
+        };
+
+        const auto numSamples = (double) numBlocks * config.blockSize;
+        const auto wall = median (seconds);
+
+        Measurement m;
+        m.nsPerSample = wall * 1.0e9 / numSamples;
+        m.realtime = (numSamples / config.sampleRate) / juce::jmax (1.0e-12, wall);
+
+       #if JUCE_INTEL
+        m.cyclesPerSample = median (cycles) / numSamples;
+       #endif
+
+        return m;
+    }
+
+    juce::Array<juce::var> parseList (const juce::String& text)
+    {
+        juce::Array<juce::var> values;
+
+        for (auto& item : juce::StringArray::fromTokens (text, ",", {}))
+            if (item.trim().isNotEmpty())
+                values.add (item.trim().getDoubleValue());
+
+        return values;
+    }
+
+    juce::var getMachineInfo()
+    {
+        auto* machine = new juce::DynamicObject();
+        machine->setProperty ("cpu", juce::SystemStats::getCpuModel());
+        machine->setProperty ("cpuMHz", juce::SystemStats::getCpuSpeedInMegahertz());
+        machine->setProperty ("cores", juce::SystemStats::getNumCpus());
+        machine->setProperty ("os", juce::SystemStats::getOperatingSystemName());
+        machine->setProperty ("juce", juce::SystemStats::getJUCEVersion());
+       #if JUCE_DEBUG
+        machine->setProperty ("debugBuild", true);
+       #else
+        machine->setProperty ("debugBuild", false);
+       #endif
+        machine->setProperty ("time", juce::Time::getCurrentTime().toISO8601 (true));
+        return machine;
+    }
+
+    int fail (const juce::String& message)
+    {
+        std::cerr << message << std::endl;
+        return 1;
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    juce::ArgumentList args (argc, argv);
+
+    juce::String engines = "all", jsonPath;
+    auto bands = parseList ("1,4," + juce::String (maxNumFilterBands));
+    auto blocks = parseList ("16,64,256,1024,4096,16384");
+    auto channels = parseList ("1,2");
+    auto rates = parseList ("44100,48000,96000,192000");
+    auto events = parseList ("0,1,16");
+    double secondsOfAudio = 2.0;
+    int repeats = 5;
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        auto& arg = args[i];
+        auto next = [&] { return i + 1 < args.size() ? args[++i].text : juce::String(); };
+
+        if      (arg == "--engine")    engines = next();
+        else if (arg == "--bands")     bands = parseList (next());
+        else if (arg == "--blocks")    blocks = parseList (next());
+        else if (arg == "--channels")  channels = parseList (next());
+        else if (arg == "--rates")     rates = parseList (next());
+        else if (arg == "--events")    events = parseList (next());
+        else if (arg == "--seconds")   secondsOfAudio = juce::jmax (0.01, next().getDoubleValue());
+        else if (arg == "--repeats")   repeats = juce::jlimit (1, 101, next().getIntValue());
+        else if (arg == "--json")      jsonPath = next();
+        else                           return fail ("Unknown option " + arg.text);
+    }
+
+    // Build the matrix; dimensions an engine doesn't have are held at one value
+    std::vector<Config> configs;
+
+    for (auto engine : { "processor", "library" })
+    {
+        if (engines != "all" && engines != engine)
+            continue;
+
+        const bool isProcessor = juce::String (engine) == "processor";
+
+        for (auto& b : bands)
+            for (auto& size : blocks)
+                for (auto& c : isProcessor ? juce::Array<juce::var> { 2 } : channels)
+                    for (auto& rate : rates)
+                        for (auto& e : isProcessor ? events : juce::Array<juce::var> { 0 })
+                            configs.push_back ({ engine,
+                                                 juce::jlimit (1, maxNumFilterBands, (int) b),
+                                                 juce::jlimit (16, 16384, (int) size),
+                                                 juce::jlimit (1, 64, (int) c),
+                                                 (double) rate,
+                                                 juce::jlimit (0, 256, (int) e) });
+    }
+
+    if (configs.empty())
+        return fail ("Nothing to run; --engine must be processor, library or all");
+
+    const bool tableToStdout = jsonPath != "-";
+    juce::Array<juce::var> results;
+
+    if (tableToStdout)
+        std::cout << "engine     bands  block  ch    rate  events     ns/sample  cycles/sample    x-realtime" << std::endl;
+
+    for (auto& config : configs)
+    {
+        const auto m = measure (config, secondsOfAudio, repeats);
+
+        auto* result = new juce::DynamicObject();
+        result->setProperty ("engine", config.engine);
+        result->setProperty ("bands", config.bands);
+        result->setProperty ("blockSize", config.blockSize);
+        result->setProperty ("channels", config.channels);
+        result->setProperty ("sampleRate", config.sampleRate);
+        result->setProperty ("eventsPerBlock", config.eventsPerBlock);
+        result->setProperty ("nsPerSample", m.nsPerSample);
+        result->setProperty ("cyclesPerSample", m.cyclesPerSample >= 0.0 ? juce::var (m.cyclesPerSample) : juce::var());
+        result->setProperty ("realtime", m.realtime);
+        results.add (result);
+
+        if (tableToStdout)
+            std::cout << config.engine.paddedRight (' ', 10)
+                      << juce::String (config.bands).paddedLeft (' ', 6)
+                      << juce::String (config.blockSize).paddedLeft (' ', 7)
+                      << juce::String (config.channels).paddedLeft (' ', 4)
+                      << juce::String ((int) config.sampleRate).paddedLeft (' ', 8)
+                      << juce::String (config.eventsPerBlock).paddedLeft (' ', 8)
+                      << juce::String (m.nsPerSample, 2).paddedLeft (' ', 14)
+                      << (m.cyclesPerSample >= 0.0 ? juce::String (m.cyclesPerSample, 1) : juce::String ("-")).paddedLeft (' ', 15)
+                      << juce::String (m.realtime, 1).paddedLeft (' ', 14) << std::endl;
+    }
+
+    if (jsonPath.isNotEmpty())
+    {
+        auto* report = new juce::DynamicObject();
+        report->setProperty ("machine", getMachineInfo());
+        report->setProperty ("secondsOfAudio", secondsOfAudio);
+        report->setProperty ("repeats", repeats);
+        report->setProperty ("results", results);
+
+        const auto json = juce::JSON::toString (juce::var (report));
+
+        if (jsonPath == "-")
+            std::cout << json << std::endl;
+        else if (! juce::File::getCurrentWorkingDirectory().getChildFile (jsonPath).replaceWithText (json))
+            return fail ("Can't write " + jsonPath);
+    }
+
+    return 0;
+}
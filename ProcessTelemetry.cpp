@@ -0,0 +1,216 @@
+/*
+  ==============================================================================
+
+    ProcessTelemetry.cpp
+    Created: 19 Oct 2026 10:18:18am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "ProcessTelemetry.h"
+
+#if JUCE_INTEL
+ #if JUCE_MSVC
+  #include <intrin.h>
+ #else
+  #include <x86intrin.h>
+ #endif
+#endif
+
+namespace
+{
+    inline juce::uint64 readCounter() noexcept
+    {
+       #if JUCE_INTEL
+        return (juce::uint64) __rdtsc();
+       #else
+        return (juce::uint64) juce::Time::getHighResolutionTicks();
+       #endif
+    }
+
+    // Only the audio thread writes the counters, so they don't need a locked add
+    template <typename Type>
+    inline void add (std::atomic<Type>& counter, Type amount) noexcept
+    {
+        counter.store (counter.load (std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    int findBucket (double load) noexcept
+    {
+        if (load < 1.0)
+            return juce::jlimit (0, 19, (int) (load * 20.0));
+
+        return load < 1.25 ? 20 : load < 1.5 ? 21 : load < 2.0 ? 22 : 23;
+    }
+}
+
+//==============================================================================
+double ProcessTelemetry::getBucketLimit (int bucket) noexcept
+{
+    if (bucket < 20)
+        return (bucket + 1) * 0.05;
+
+    constexpr double limits[] = { 1.25, 1.5, 2.0 };
+    return bucket < numHistogramBuckets - 1 ? limits[bucket - 20] : std::numeric_limits<double>::infinity();
+}
+
+const char* ProcessTelemetry::getStageName (Stage stage) noexcept
+{
+    switch (stage)
+    {
+        case parameterRead:      return "parameterRead";
+        case coefficientUpdate:  return "coefficientUpdate";
+        case cascade:            return "cascade";
+        case gainAndMix:         return "gainAndMix";
+        case analyserTap:        return "analyserTap";
+        case numStages:
+        default:                 break;
+    }
+
+    return "";
+}
+
+ProcessTelemetry::ProcessTelemetry()
+{
+    clear();
+}
+
+void ProcessTelemetry::prepare (double newSampleRate) noexcept
+{
+    sampleRate = newSampleRate;
+}
+
+void ProcessTelemetry::clear() noexcept
+{
+    numBlocks = 0;
+    numSamples = 0;
+    nearMisses = 0;
+    misses = 0;
+    busyTicks = 0;
+    worstLoad = 0.0;
+
+    for (auto& count : stageCounts)
+        count = 0;
+
+    for (auto& count : histogram)
+        count = 0;
+}
+
+void ProcessTelemetry::commit (const std::array<juce::uint64, numStages>& counts, int blockSamples, juce::int64 ticks) noexcept
+{
+    if (resetPending.exchange (false))
+        clear();
+
+    const auto rate = sampleRate.load (std::memory_order_relaxed);
+
+    if (rate <= 0.0 || blockSamples <= 0)
+        return;
+
+    const auto load = juce::Time::highResolutionTicksToSeconds (ticks) * rate / blockSamples;
+
+    add (numBlocks, (juce::int64) 1);
+    add (numSamples, (juce::int64) blockSamples);
+    add (busyTicks, ticks);
+    add (histogram[(size_t) findBucket (load)], (juce::int64) 1);
+
+    for (size_t i = 0; i < counts.size(); ++i)
+        add (stageCounts[i], counts[i]);
+
+    if (load >= 1.0)
+        add (misses, (juce::int64) 1);
+    else if (load >= nearMissThreshold.load (std::memory_order_relaxed))
+        add (nearMisses, (juce::int64) 1);
+
+    if (load > worstLoad.load (std::memory_order_relaxed))
+        worstLoad.store (load, std::memory_order_relaxed);
+}
+
+ProcessTelemetry::Snapshot ProcessTelemetry::getSnapshot() const noexcept
+{
+    Snapshot s;
+    s.sampleRate = sampleRate;
+    s.nearMissThreshold = nearMissThreshold;
+    s.numBlocks = numBlocks;
+    s.numSamples = numSamples;
+    s.nearMisses = nearMisses;
+    s.misses = misses;
+    s.busySeconds = juce::Time::highResolutionTicksToSeconds (busyTicks);
+    s.worstLoad = worstLoad;
+
+    for (size_t i = 0; i < stageCounts.size(); ++i)
+        s.stageCounts[i] = stageCounts[i];
+
+    for (size_t i = 0; i < histogram.size(); ++i)
+        s.histogram[i] = histogram[i];
+
+   #if JUCE_INTEL
+    s.countsAreCycles = true;
+   #endif
+
+    return s;
+}
+
+//==============================================================================
+ProcessTelemetry::Block::Block (ProcessTelemetry& telemetry, int blockSamples) noexcept
+    : owner (telemetry),
+      numSamples (blockSamples),
+      startTicks (juce::Time::getHighResolutionTicks()),
+      lastCount (readCounter())
+{
+}
+
+ProcessTelemetry::Block::~Block()
+{
+    owner.commit (counts, numSamples, juce::Time::getHighResolutionTicks() - startTicks);
+}
+
+void ProcessTelemetry::Block::lap (Stage stage) noexcept
+{
+    const auto count = readCounter();
+    counts[(size_t) stage] += count - lastCount;
+    lastCount = count;
+}
+
+//==============================================================================
+double ProcessTelemetry::Snapshot::getAverageLoad() const noexcept
+{
+    return numSamples > 0 && sampleRate > 0.0 ? busySeconds * sampleRate / (double) numSamples : 0.0;
+}
+
+double ProcessTelemetry::Snapshot::getCountsPerSample (Stage stage) const noexcept
+{
+    return numSamples > 0 ? (double) stageCounts[(size_t) stage] / (double) numSamples : 0.0;
+}
+
+juce::var ProcessTelemetry::Snapshot::toVar() const
+{
+    auto* stages = new juce::DynamicObject();
+
+    for (int i = 0; i < numStages; ++i)
+        stages->setProperty (getStageName ((Stage) i), getCountsPerSample ((Stage) i));
+
+    juce::Array<juce::var> buckets;
+
+    for (int i = 0; i < numHistogramBuckets; ++i)
+    {
+        auto* bucket = new juce::DynamicObject();
+        const auto limit = getBucketLimit (i);
+        bucket->setProperty ("upTo", std::isinf (limit) ? juce::var() : juce::var (limit));
+        bucket->setProperty ("blocks", histogram[(size_t) i]);
+        buckets.add (bucket);
+    }
+
+    auto* result = new juce::DynamicObject();
+    result->setProperty ("sampleRate", sampleRate);
+    result->setProperty ("blocks", numBlocks);
+    result->setProperty ("samples", numSamples);
+    result->setProperty ("averageLoad", getAverageLoad());
+    result->setProperty ("worstLoad", worstLoad);
+    result->setProperty ("nearMissThreshold", nearMissThreshold);
+    result->setProperty ("nearMisses", nearMisses);
+    result->setProperty ("misses", misses);
+    result->setProperty (countsAreCycles ? "cyclesPerSample" : "ticksPerSample", stages);
+    result->setProperty ("histogram", buckets);
+    return result;
+}
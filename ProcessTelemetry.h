@@ -0,0 +1,112 @@
+/*
+  ==============================================================================
+
+    ProcessTelemetry.h
+    Created: 19 Oct 2026 10:18:18am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Where the audio callback spends its time, and how close it comes to its deadline.
+
+    The audio thread times each processBlock call with a Block on the stack,
+    splitting the time between stages as it goes, and adds the results to
+    counters that any thread can read without locking. Every call also lands
+    in a histogram of its duration as a fraction of the block's length in
+    real time, which is the most it could ever be given by the host.
+
+    Stage times are in CPU cycles on x86 and high-resolution ticks elsewhere.
+*/
+class ProcessTelemetry
+{
+public:
+    enum Stage
+    {
+        parameterRead,          // generation checks, event queue and smoother targets
+        coefficientUpdate,      // redesigning gliding bands
+        cascade,                // the filter bank itself
+        gainAndMix,
+        analyserTap,
+        numStages
+    };
+
+    // 5% wide up to the deadline, then 100-125%, 125-150%, 150-200% and beyond
+    static constexpr int numHistogramBuckets = 24;
+
+    /** The top of a bucket as a fraction of the deadline; the last bucket has no top. */
+    static double getBucketLimit (int bucket) noexcept;
+
+    static const char* getStageName (Stage) noexcept;
+
+    ProcessTelemetry();
+
+    /** From prepareToPlay. */
+    void prepare (double sampleRate) noexcept;
+
+    /** Blocks taking at least this fraction of their deadline count as near misses; 0.7 by default. */
+    void setNearMissThreshold (double fraction) noexcept    { nearMissThreshold = juce::jlimit (0.01, 1.0, fraction); }
+
+    /** Any thread: everything is zeroed by the audio thread at its next block. */
+    void reset() noexcept                                   { resetPending = true; }
+
+    //==============================================================================
+    /** Times one processBlock call from construction to destruction. lap() gives
+        the time since the previous lap (or the start) to a stage.
+    */
+    class Block
+    {
+    public:
+        Block (ProcessTelemetry&, int numSamples) noexcept;
+        ~Block();
+
+        void lap (Stage) noexcept;
+
+    private:
+        ProcessTelemetry& owner;
+        int numSamples;
+        juce::int64 startTicks;
+        juce::uint64 lastCount;
+        std::array<juce::uint64, numStages> counts {};
+
+        JUCE_DECLARE_NON_COPYABLE (Block)
+    };
+
+    //==============================================================================
+    struct Snapshot
+    {
+        double sampleRate = 0.0, nearMissThreshold = 0.0;
+        juce::int64 numBlocks = 0, numSamples = 0, nearMisses = 0, misses = 0;
+        double busySeconds = 0.0, worstLoad = 0.0;
+        std::array<juce::uint64, numStages> stageCounts {};
+        std::array<juce::int64, numHistogramBuckets> histogram {};
+        bool countsAreCycles = false;
+
+        /** Time spent processing over the audio time processed. */
+        double getAverageLoad() const noexcept;
+        double getCountsPerSample (Stage) const noexcept;
+
+        juce::var toVar() const;
+    };
+
+    /** Any thread. Counters are read one at a time, so a block may land part way through. */
+    Snapshot getSnapshot() const noexcept;
+
+private:
+    void commit (const std::array<juce::uint64, numStages>& counts, int numSamples, juce::int64 ticks) noexcept;
+    void clear() noexcept;
+
+    std::atomic<double> sampleRate { 0.0 }, nearMissThreshold { 0.7 }, worstLoad { 0.0 };
+    std::atomic<juce::int64> numBlocks { 0 }, numSamples { 0 }, nearMisses { 0 }, misses { 0 }, busyTicks { 0 };
+    std::array<std::atomic<juce::uint64>, numStages> stageCounts;
+    std::array<std::atomic<juce::int64>, numHistogramBuckets> histogram;
+    std::atomic<bool> resetPending { false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ProcessTelemetry)
+};
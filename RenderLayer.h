@@ -0,0 +1,66 @@
+/*
+  ==============================================================================
+
+    RenderLayer.h
+    Created: 19 Oct 2026 9:46:12am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    An image cache for one layer of a component's paint().
+
+    The layer is only re-rendered after invalidate() or when the component's
+    size or display scale changes; otherwise draw() is a single image blit.
+*/
+class RenderLayer
+{
+public:
+    explicit RenderLayer (bool isOpaque) : opaque (isOpaque) {}
+
+    void invalidate() noexcept      { valid = false; }
+
+    template <typename RenderFunction>
+    void draw (juce::Graphics& g, juce::Component& owner, RenderFunction&& render)
+    {
+        auto bounds = owner.getLocalBounds();
+        auto scale = juce::Component::getApproximateScaleFactorForComponent (&owner);
+        auto width = juce::roundToInt ((float) bounds.getWidth() * scale);
+        auto height = juce::roundToInt ((float) bounds.getHeight() * scale);
+
+        if (width <= 0 || height <= 0)
+            return;
+
+        if (! image.isValid() || image.getWidth() != width || image.getHeight() != height)
+        {
+            image = juce::Image (opaque ? juce::Image::RGB : juce::Image::ARGB, width, height, true);
+            valid = false;
+        }
+
+        if (! valid)
+        {
+            image.clear (image.getBounds());
+
+            juce::Graphics imageGraphics (image);
+            imageGraphics.addTransform (juce::AffineTransform::scale (scale));
+            render (imageGraphics);
+
+            valid = true;
+        }
+
+        g.drawImage (image, bounds.toFloat());
+    }
+
+private:
+    juce::Image image;
+    bool opaque;
+    bool valid = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (RenderLayer)
+};
@@ -0,0 +1,120 @@
+/*
+  ==============================================================================
+
+    ScopePyramid.cpp
+    Created: 19 Oct 2026 9:45:04am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "ScopePyramid.h"
+
+//==============================================================================
+ScopePyramid::ScopePyramid()
+{
+    for (auto& level : levels)
+    {
+        level.mins.resize ((size_t) bucketsPerLevel);
+        level.maxs.resize ((size_t) bucketsPerLevel);
+    }
+
+    reset();
+}
+
+void ScopePyramid::reset()
+{
+    const juce::SpinLock::ScopedLockType sl (lock);
+
+    for (auto& level : levels)
+    {
+        std::fill (level.mins.begin(), level.mins.end(), 0.0f);
+        std::fill (level.maxs.begin(), level.maxs.end(), 0.0f);
+        level.numWritten = 0;
+        level.hasPending = false;
+    }
+}
+
+void ScopePyramid::push (const float* samples, int numSamples)
+{
+    const juce::SpinLock::ScopedLockType sl (lock);
+
+    for (int i = 0; i < numSamples; ++i)
+        addBucket (samples[i], samples[i]);
+}
+
+void ScopePyramid::addBucket (float low, float high)
+{
+    constexpr auto mask = (juce::int64) bucketsPerLevel - 1;
+
+    for (int index = 0; index < numLevels; ++index)
+    {
+        auto& level = levels[(size_t) index];
+        auto slot = (size_t) (level.numWritten & mask);
+
+        level.mins[slot] = low;
+        level.maxs[slot] = high;
+        ++level.numWritten;
+
+        if (index + 1 == numLevels)
+            break;
+
+        // Every second bucket completes one bucket on the level above
+        auto& above = levels[(size_t) index + 1];
+
+        if (! above.hasPending)
+        {
+            above.pendingMin = low;
+            above.pendingMax = high;
+            above.hasPending = true;
+            break;
+        }
+
+        low = juce::jmin (low, above.pendingMin);
+        high = juce::jmax (high, above.pendingMax);
+        above.hasPending = false;
+    }
+}
+
+void ScopePyramid::render (float* mins, float* maxs, int numPixels, juce::int64 numSamplesToShow) const
+{
+    if (numPixels <= 0)
+        return;
+
+    constexpr auto mask = (juce::int64) bucketsPerLevel - 1;
+    const auto samplesPerPixel = (double) juce::jmax ((juce::int64) 1, numSamplesToShow) / numPixels;
+
+    // Pick the coarsest level whose buckets are still no wider than a pixel
+    int index = 0;
+
+    while (index + 1 < numLevels && (double) (1 << (index + 1)) <= samplesPerPixel)
+        ++index;
+
+    const juce::SpinLock::ScopedLockType sl (lock);
+
+    const auto& level = levels[(size_t) index];
+    const auto bucketsPerPixel = samplesPerPixel / (double) (1 << index);
+    const auto newest = (double) level.numWritten;
+    const auto oldestAvailable = juce::jmax ((juce::int64) 0, level.numWritten - bucketsPerLevel);
+
+    for (int pixel = 0; pixel < numPixels; ++pixel)
+    {
+        auto start = (juce::int64) std::floor (newest - (numPixels - pixel) * bucketsPerPixel);
+        auto end = juce::jmax (start + 1, (juce::int64) std::floor (newest - (numPixels - pixel - 1) * bucketsPerPixel));
+
+        float low = 0.0f, high = 0.0f;
+        bool found = false;
+
+        for (auto bucket = juce::jmax (start, oldestAvailable); bucket < end; ++bucket)
+        {
+            auto slot = (size_t) (bucket & mask);
+
+            low  = found ? juce::jmin (low,  level.mins[slot]) : level.mins[slot];
+            high = found ? juce::jmax (high, level.maxs[slot]) : level.maxs[slot];
+            found = true;
+        }
+
+        mins[pixel] = low;
+        maxs[pixel] = high;
+    }
+}
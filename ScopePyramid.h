@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    ScopePyramid.h
+    Created: 19 Oct 2026 9:45:04am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Decimating min/max summary of a signal's recent history for the scope views.
+
+    Level 0 holds raw samples and each level above holds min/max pairs covering
+    twice as many samples as the one below. Every level is a ring of the same
+    size, so the pyramid is updated incrementally as blocks arrive and a view
+    can be drawn at exactly one min/max pair per pixel at any zoom, from a few
+    milliseconds up to tens of seconds, without touching the raw samples.
+*/
+class ScopePyramid
+{
+public:
+    static constexpr int numLevels = 18;
+    static constexpr int bucketsPerLevel = 1 << 13;
+
+    ScopePyramid();
+
+    void reset();
+
+    /** Adds samples to the history. Safe to call on one thread while another renders. */
+    void push (const float* samples, int numSamples);
+
+    /** Fills one min/max pair per pixel summarising the most recent numSamplesToShow
+        samples, oldest on the left. Pixels before the start of the history are zero.
+    */
+    void render (float* mins, float* maxs, int numPixels, juce::int64 numSamplesToShow) const;
+
+    size_t getMemoryUsage() const noexcept  { return sizeof (*this) + (size_t) numLevels * bucketsPerLevel * 2 * sizeof (float); }
+
+    /** The longest span, in samples, that render() can show before running out of history. */
+    static juce::int64 getMaximumSpan()     { return (juce::int64) (bucketsPerLevel / 2) << (numLevels - 1); }
+
+private:
+    struct Level
+    {
+        std::vector<float> mins, maxs;
+        juce::int64 numWritten = 0;
+
+        // The first of the two buckets from the level below, waiting for its partner
+        float pendingMin = 0.0f, pendingMax = 0.0f;
+        bool hasPending = false;
+    };
+
+    void addBucket (float low, float high);
+
+    std::array<Level, numLevels> levels;
+    mutable juce::SpinLock lock;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ScopePyramid)
+};
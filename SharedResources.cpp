@@ -0,0 +1,128 @@
+/*
+  ==============================================================================
+
+    SharedResources.cpp
+    Created: 19 Oct 2026 9:55:53am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "SharedResources.h"
+#include "FrequencyMapping.h"
+
+namespace
+{
+    /** Returns the live entry for key, or builds a new one and drops any that have expired. */
+    template <typename Map, typename Key, typename Create>
+    auto findOrCreate (Map& map, const Key& key, Create&& create)
+    {
+        if (auto existing = map[key].lock())
+            return existing;
+
+        for (auto it = map.begin(); it != map.end();)
+            it = it->second.expired() && it->first != key ? map.erase (it) : std::next (it);
+
+        auto created = create();
+        map[key] = created;
+        return created;
+    }
+}
+
+//==============================================================================
+SharedAnalysisTables::SharedAnalysisTables()
+    : window ((size_t) fftSize)
+{
+    juce::dsp::WindowingFunction<float>::fillWindowingTables (window.data(), (size_t) fftSize,
+                                                              juce::dsp::WindowingFunction<float>::hann, false);
+}
+
+//==============================================================================
+std::shared_ptr<const LogBinMap> SharedLogFrequencyMaps::getBinMap (int numRows, int numBins, double sampleRate)
+{
+    const juce::ScopedLock sl (lock);
+
+    return findOrCreate (maps, std::make_tuple (numRows, numBins, sampleRate), [&]
+    {
+        auto map = std::make_shared<LogBinMap>();
+        map->firstBin.resize ((size_t) numRows);
+        map->lastBin.resize ((size_t) numRows);
+
+        const auto fftSize = numBins * 2;
+
+        for (int y = 0; y < numRows; ++y)
+        {
+            // Row 0 is the top of the display, i.e. the highest frequency
+            auto upper = LogFrequencyMap::proportionToFrequency (1.0f - (float) y / (float) numRows);
+            auto lower = LogFrequencyMap::proportionToFrequency (1.0f - (float) (y + 1) / (float) numRows);
+
+            auto first = juce::jlimit (0, numBins - 1, juce::roundToInt (LogFrequencyMap::frequencyToBin (lower, fftSize, sampleRate)));
+            auto last  = juce::jlimit (first, numBins - 1, juce::roundToInt (LogFrequencyMap::frequencyToBin (upper, fftSize, sampleRate)));
+
+            map->firstBin[(size_t) y] = first;
+            map->lastBin[(size_t) y] = last;
+        }
+
+        return std::shared_ptr<const LogBinMap> (std::move (map));
+    });
+}
+
+//==============================================================================
+PeakDesignTable::PeakDesignTable (double rate)
+    : sampleRate (rate),
+      radiansPerHertz (juce::MathConstants<double>::twoPi / rate),
+      gridPointsPerRadian (gridSize / juce::MathConstants<double>::pi),
+      cosTable ((size_t) gridSize + 1),
+      sinTable ((size_t) gridSize + 1)
+{
+    for (int i = 0; i <= gridSize; ++i)
+    {
+        auto omega = juce::MathConstants<double>::pi * i / gridSize;
+        cosTable[(size_t) i] = std::cos (omega);
+        sinTable[(size_t) i] = std::sin (omega);
+    }
+}
+
+void PeakDesignTable::getTrig (double frequency, double& cosOmega, double& sinOmega) const noexcept
+{
+    const auto omega = juce::jlimit (0.0, juce::MathConstants<double>::pi, frequency * radiansPerHertz);
+    const auto index = juce::jmin (gridSize, (int) (omega * gridPointsPerRadian));
+    const auto d = omega - index / gridPointsPerRadian;
+
+    // cos/sin of the remainder; |d| < pi / gridSize, so the next terms are below 1e-17
+    const auto d2 = d * d;
+    const auto cosD = 1.0 - d2 * (0.5 - d2 * (1.0 / 24.0));
+    const auto sinD = d * (1.0 - d2 * (1.0 / 6.0 - d2 * (1.0 / 120.0)));
+
+    const auto c = cosTable[(size_t) index], s = sinTable[(size_t) index];
+    cosOmega = c * cosD - s * sinD;
+    sinOmega = s * cosD + c * sinD;
+}
+
+void PeakDesignTable::designPeak (float frequency, float Q, float gainDecibels, float* coefficients) const noexcept
+{
+    double cosOmega, sinOmega;
+    getTrig (frequency, cosOmega, sinOmega);
+
+    const auto A = std::sqrt (juce::jmax (1.0e-6, (double) juce::Decibels::decibelsToGain (gainDecibels)));
+    const auto alpha = 0.5 * sinOmega / juce::jmax (1.0e-3, (double) Q);
+    const auto c2 = -2.0 * cosOmega;
+    const auto a0 = 1.0 / (1.0 + alpha / A);
+
+    coefficients[0] = (float) ((1.0 + alpha * A) * a0);
+    coefficients[1] = (float) (c2 * a0);
+    coefficients[2] = (float) ((1.0 - alpha * A) * a0);
+    coefficients[3] = (float) (c2 * a0);
+    coefficients[4] = (float) ((1.0 - alpha / A) * a0);
+}
+
+//==============================================================================
+std::shared_ptr<const PeakDesignTable> SharedCoefficientTables::getPeakTable (double sampleRate)
+{
+    const juce::ScopedLock sl (lock);
+
+    return findOrCreate (tables, sampleRate, [&]
+    {
+        return std::shared_ptr<const PeakDesignTable> (std::make_shared<PeakDesignTable> (sampleRate));
+    });
+}
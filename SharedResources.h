@@ -0,0 +1,101 @@
+/*
+  ==============================================================================
+
+    SharedResources.h
+    Created: 19 Oct 2026 9:55:53am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/*
+    Immutable tables shared by every JarEQ instance in the host process.
+    Hold them through juce::SharedResourcePointer; the first instance builds
+    them and the last one to go frees them. Tables keyed by layout or sample
+    rate are handed out as shared_ptrs and dropped once no instance uses them.
+*/
+
+//==============================================================================
+/** The analyser's FFT plan and Hann window. */
+class SharedAnalysisTables
+{
+public:
+    static constexpr int fftOrder = 13;
+    static constexpr int fftSize = 1 << fftOrder;
+
+    SharedAnalysisTables();
+
+    /** dsp::FFT's transforms are const, so one plan can serve every analyser thread. */
+    const juce::dsp::FFT& getFFT() const noexcept       { return fft; }
+
+    /** fftSize samples of an unnormalised Hann window. */
+    const float* getWindow() const noexcept             { return window.data(); }
+
+private:
+    juce::dsp::FFT fft { fftOrder };
+    std::vector<float> window;
+
+    JUCE_DECLARE_NON_COPYABLE (SharedAnalysisTables)
+};
+
+//==============================================================================
+/** Which FFT bins fall in each row of a log-frequency display, top row first. */
+struct LogBinMap
+{
+    std::vector<int> firstBin, lastBin;
+};
+
+class SharedLogFrequencyMaps
+{
+public:
+    std::shared_ptr<const LogBinMap> getBinMap (int numRows, int numBins, double sampleRate);
+
+private:
+    juce::CriticalSection lock;
+    std::map<std::tuple<int, int, double>, std::weak_ptr<const LogBinMap>> maps;
+};
+
+//==============================================================================
+/**
+    Trig for biquad design at one sample rate.
+
+    Holds cos and sin of the normalised frequency on a fine linear grid up to
+    Nyquist. The remainder between grid points is below a milliradian, so a
+    short series finishes it off to double precision without calling any
+    trig functions on the audio thread.
+*/
+class PeakDesignTable
+{
+public:
+    explicit PeakDesignTable (double sampleRate);
+
+    double getSampleRate() const noexcept       { return sampleRate; }
+
+    void getTrig (double frequency, double& cosOmega, double& sinOmega) const noexcept;
+
+    /** Normalised { b0, b1, b2, a1, a2 }, the same response as IIRCoefficients::makePeakFilter(). */
+    void designPeak (float frequency, float Q, float gainDecibels, float* coefficients) const noexcept;
+
+private:
+    static constexpr int gridSize = 4096;
+
+    double sampleRate, radiansPerHertz, gridPointsPerRadian;
+    std::vector<double> cosTable, sinTable;
+
+    JUCE_DECLARE_NON_COPYABLE (PeakDesignTable)
+};
+
+class SharedCoefficientTables
+{
+public:
+    std::shared_ptr<const PeakDesignTable> getPeakTable (double sampleRate);
+
+private:
+    juce::CriticalSection lock;
+    std::map<double, std::weak_ptr<const PeakDesignTable>> tables;
+};
@@ -0,0 +1,117 @@
+/*
+  ==============================================================================
+
+    Spectrogram.cpp
+    Created: 19 Oct 2026 9:41:13am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "Spectrogram.h"
+
+//==============================================================================
+SpectrogramComponent::SpectrogramComponent()
+{
+    setOpaque (true);
+    buildColourTable();
+}
+
+SpectrogramComponent::~SpectrogramComponent()
+{
+}
+
+void SpectrogramComponent::paint (juce::Graphics& g)
+{
+    if (! ringImage.isValid())
+    {
+        g.fillAll (juce::Colours::black);
+        return;
+    }
+
+    auto w = ringImage.getWidth();
+    auto h = ringImage.getHeight();
+
+    // The oldest column is the next one to be written, so draw from there to
+    // the end of the ring on the left, then wrap round to the newest on the right
+    auto olderWidth = w - writeColumn;
+    g.drawImage (ringImage, 0, 0, olderWidth, h, writeColumn, 0, olderWidth, h);
+
+    if (writeColumn > 0)
+        g.drawImage (ringImage, olderWidth, 0, writeColumn, h, 0, 0, writeColumn, h);
+}
+
+void SpectrogramComponent::resized()
+{
+    ringImage = juce::Image (juce::Image::RGB, juce::jmax (1, getWidth()), juce::jmax (1, getHeight()), true);
+    writeColumn = 0;
+    mappedNumBins = 0;
+}
+
+void SpectrogramComponent::setDecibelRange (float newMinDecibels, float newMaxDecibels)
+{
+    jassert (newMaxDecibels > newMinDecibels);
+    minDecibels = newMinDecibels;
+    maxDecibels = newMaxDecibels;
+}
+
+void SpectrogramComponent::clear()
+{
+    ringImage.clear (ringImage.getBounds());
+    writeColumn = 0;
+    repaint();
+}
+
+void SpectrogramComponent::pushFrame (const float* magnitudesInDecibels, int numBins, double sampleRate)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    if (! ringImage.isValid() || numBins <= 0 || sampleRate <= 0.0)
+        return;
+
+    if (numBins != mappedNumBins || sampleRate != mappedSampleRate)
+        updateRowMapping (numBins, sampleRate);
+
+    const auto scale = (float) (colourTableSize - 1) / (maxDecibels - minDecibels);
+
+    {
+        juce::Image::BitmapData column (ringImage, writeColumn, 0, 1, ringImage.getHeight(), juce::Image::BitmapData::writeOnly);
+
+        for (int y = 0; y < column.height; ++y)
+        {
+            const auto first = rowMap->firstBin[(size_t) y];
+            const auto last = rowMap->lastBin[(size_t) y];
+            auto level = magnitudesInDecibels[first];
+
+            for (int bin = first + 1; bin <= last; ++bin)
+                level = juce::jmax (level, magnitudesInDecibels[bin]);
+
+            auto index = juce::jlimit (0, colourTableSize - 1, (int) ((level - minDecibels) * scale));
+            reinterpret_cast<juce::PixelRGB*> (column.getPixelPointer (0, y))->set (colourTable[(size_t) index]);
+        }
+    }
+
+    writeColumn = (writeColumn + 1) % ringImage.getWidth();
+    repaint();
+}
+
+void SpectrogramComponent::updateRowMapping (int numBins, double sampleRate)
+{
+    rowMap = logFrequencyMaps->getBinMap (ringImage.getHeight(), numBins, sampleRate);
+
+    mappedNumBins = numBins;
+    mappedSampleRate = sampleRate;
+}
+
+void SpectrogramComponent::buildColourTable()
+{
+    juce::ColourGradient gradient;
+    gradient.addColour (0.0,  juce::Colours::black);
+    gradient.addColour (0.25, juce::Colour (0xff1a1a80));
+    gradient.addColour (0.5,  juce::Colour (0xffa0207a));
+    gradient.addColour (0.75, juce::Colour (0xfff08020));
+    gradient.addColour (1.0,  juce::Colours::lightyellow);
+
+    for (int i = 0; i < colourTableSize; ++i)
+        colourTable[(size_t) i] = gradient.getColourAtPosition ((double) i / (colourTableSize - 1)).getPixelARGB();
+}
@@ -0,0 +1,61 @@
+/*
+  ==============================================================================
+
+    Spectrogram.h
+    Created: 19 Oct 2026 9:41:13am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SharedResources.h"
+
+//==============================================================================
+/**
+    Scrolling spectrogram.
+
+    Each analysis frame is written as a single column into a preallocated image
+    that is used as a ring buffer, so painting only blits the two halves of the
+    ring instead of redrawing the history.
+*/
+class SpectrogramComponent  : public juce::Component
+{
+public:
+    SpectrogramComponent();
+    ~SpectrogramComponent() override;
+
+    void paint (juce::Graphics&) override;
+    void resized() override;
+
+    /** Writes one column from a frame of bin magnitudes in decibels.
+        Must be called on the message thread.
+    */
+    void pushFrame (const float* magnitudesInDecibels, int numBins, double sampleRate);
+
+    void setDecibelRange (float newMinDecibels, float newMaxDecibels);
+    void clear();
+
+private:
+    void updateRowMapping (int numBins, double sampleRate);
+    void buildColourTable();
+
+    static constexpr int colourTableSize = 256;
+
+    juce::Image ringImage;
+    int writeColumn = 0;
+
+    // Which FFT bins land in each row of the image, shared with other views of the same size
+    juce::SharedResourcePointer<SharedLogFrequencyMaps> logFrequencyMaps;
+    std::shared_ptr<const LogBinMap> rowMap;
+    int mappedNumBins = 0;
+    double mappedSampleRate = 0.0;
+
+    std::array<juce::PixelARGB, colourTableSize> colourTable;
+    float minDecibels = -100.0f;
+    float maxDecibels = 0.0f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SpectrogramComponent)
+};
@@ -0,0 +1,246 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyser.cpp
+    Created: 19 Oct 2026 9:42:59am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "SpectrumAnalyser.h"
+
+//==============================================================================
+SpectrumAnalyser::SpectrumAnalyser() : juce::Thread ("JarEQ Spectrum Analyser")
+{
+}
+
+SpectrumAnalyser::~SpectrumAnalyser()
+{
+    stopThread (1000);
+}
+
+void SpectrumAnalyser::prepare (double sampleRate, int maximumBlockSize)
+{
+    stopThread (1000);
+
+    currentSampleRate = sampleRate;
+    hopSize = juce::jlimit (64, fftSize, juce::roundToInt (sampleRate / 60.0));
+
+    for (auto* tap : { &preTap, &postTap })
+    {
+        auto fifoSize = juce::jmax (fftSize * 4, maximumBlockSize * 4);
+        tap->fifo.setTotalSize (fifoSize);
+        tap->fifo.reset();
+        tap->samples.assign ((size_t) fifoSize, 0.0f);
+        tap->history.assign ((size_t) fftSize, 0.0f);
+        tap->magnitudes.assign ((size_t) numBins, 0.0f);
+    }
+
+    downmixBuffer.assign ((size_t) maximumBlockSize, 0.0f);
+    fftBuffer.assign ((size_t) fftSize * 2, 0.0f);
+    peakMagnitudes.assign ((size_t) numBins, 0.0f);
+    averageMagnitudes.assign ((size_t) numBins, 0.0f);
+    scope.reset();
+
+    for (auto& frame : frames)
+    {
+        for (auto* trace : { &frame.pre, &frame.post, &frame.peak, &frame.average })
+            trace->assign ((size_t) numBins, -120.0f);
+
+        frame.difference.assign ((size_t) numBins, 0.0f);
+        frame.sampleRate = sampleRate;
+    }
+
+    startThread (juce::Thread::Priority::low);
+}
+
+void SpectrumAnalyser::release()
+{
+    stopThread (1000);
+}
+
+size_t SpectrumAnalyser::getMemoryUsage() const noexcept
+{
+    auto floats = fftBuffer.capacity() + downmixBuffer.capacity()
+                + peakMagnitudes.capacity() + averageMagnitudes.capacity();
+
+    for (auto* tap : { &preTap, &postTap })
+        floats += tap->samples.capacity() + tap->history.capacity() + tap->magnitudes.capacity();
+
+    for (auto& frame : frames)
+        floats += frame.pre.capacity() + frame.post.capacity() + frame.difference.capacity()
+                + frame.peak.capacity() + frame.average.capacity();
+
+    return sizeof (*this) + floats * sizeof (float) + scope.getMemoryUsage() - sizeof (scope);
+}
+
+//==============================================================================
+void SpectrumAnalyser::pushPre (const juce::AudioBuffer<float>& buffer)
+{
+    lastPreSamplesWritten = push (preTap, buffer, buffer.getNumSamples());
+}
+
+void SpectrumAnalyser::pushPost (const juce::AudioBuffer<float>& buffer)
+{
+    // Never write more than the pre tap accepted, or the two would drift apart
+    push (postTap, buffer, lastPreSamplesWritten);
+}
+
+int SpectrumAnalyser::push (Tap& tap, const juce::AudioBuffer<float>& buffer, int maxSamples)
+{
+    auto numChannels = buffer.getNumChannels();
+    auto numSamples = juce::jmin (buffer.getNumSamples(), maxSamples, (int) downmixBuffer.size());
+
+    if (numChannels == 0 || numSamples <= 0)
+        return 0;
+
+    auto* dest = downmixBuffer.data();
+    auto mode = channelMode.load();
+
+    if (mode == ChannelMode::sum || numChannels == 1)
+    {
+        juce::FloatVectorOperations::copy (dest, buffer.getReadPointer (0), numSamples);
+
+        for (int channel = 1; channel < numChannels; ++channel)
+            juce::FloatVectorOperations::add (dest, buffer.getReadPointer (channel), numSamples);
+
+        juce::FloatVectorOperations::multiply (dest, 1.0f / (float) numChannels, numSamples);
+
+        if (mode == ChannelMode::side)
+            juce::FloatVectorOperations::clear (dest, numSamples);
+    }
+    else if (mode == ChannelMode::mid)
+    {
+        juce::FloatVectorOperations::add (dest, buffer.getReadPointer (0), buffer.getReadPointer (1), numSamples);
+        juce::FloatVectorOperations::multiply (dest, 0.5f, numSamples);
+    }
+    else
+    {
+        juce::FloatVectorOperations::subtract (dest, buffer.getReadPointer (0), buffer.getReadPointer (1), numSamples);
+        juce::FloatVectorOperations::multiply (dest, 0.5f, numSamples);
+    }
+
+    // If the analysis thread falls behind we drop samples rather than block
+    const auto scope = tap.fifo.write (numSamples);
+
+    if (scope.blockSize1 > 0)
+        juce::FloatVectorOperations::copy (tap.samples.data() + scope.startIndex1, dest, scope.blockSize1);
+
+    if (scope.blockSize2 > 0)
+        juce::FloatVectorOperations::copy (tap.samples.data() + scope.startIndex2, dest + scope.blockSize1, scope.blockSize2);
+
+    return scope.blockSize1 + scope.blockSize2;
+}
+
+//==============================================================================
+bool SpectrumAnalyser::pullLatestFrame()
+{
+    if ((latestIndex.load() & newFrameFlag) == 0)
+        return false;
+
+    frontIndex = latestIndex.exchange (frontIndex) & ~newFrameFlag;
+    return true;
+}
+
+void SpectrumAnalyser::run()
+{
+    while (! threadShouldExit())
+    {
+        // Pre and post are always pushed in pairs, so consume them in lockstep
+        while (preTap.fifo.getNumReady() >= hopSize && postTap.fifo.getNumReady() >= hopSize)
+        {
+            readHop (preTap, hopSize);
+            readHop (postTap, hopSize);
+
+            auto newest = postTap.history.data() + fftSize - hopSize;
+            auto range = juce::FloatVectorOperations::findMinAndMax (newest, hopSize);
+            scope.push (newest, hopSize);
+
+            analyse (preTap);
+            analyse (postTap);
+            publishFrame (juce::jmax (-range.getStart(), range.getEnd()));
+
+            if (threadShouldExit())
+                return;
+        }
+
+        wait (5);
+    }
+}
+
+void SpectrumAnalyser::readHop (Tap& tap, int numSamples)
+{
+    auto* history = tap.history.data();
+    std::memmove (history, history + numSamples, sizeof (float) * (size_t) (fftSize - numSamples));
+
+    auto* dest = history + fftSize - numSamples;
+    const auto scope = tap.fifo.read (numSamples);
+
+    if (scope.blockSize1 > 0)
+        juce::FloatVectorOperations::copy (dest, tap.samples.data() + scope.startIndex1, scope.blockSize1);
+
+    if (scope.blockSize2 > 0)
+        juce::FloatVectorOperations::copy (dest + scope.blockSize1, tap.samples.data() + scope.startIndex2, scope.blockSize2);
+}
+
+void SpectrumAnalyser::analyse (Tap& tap)
+{
+    auto* data = fftBuffer.data();
+
+    juce::FloatVectorOperations::copy (data, tap.history.data(), fftSize);
+    juce::FloatVectorOperations::clear (data + fftSize, fftSize);
+
+    juce::FloatVectorOperations::multiply (data, tables->getWindow(), fftSize);
+    tables->getFFT().performFrequencyOnlyForwardTransform (data);
+
+    // Normalise so a full-scale sine reads 0 dB (the Hann window halves the amplitude)
+    juce::FloatVectorOperations::multiply (tap.magnitudes.data(), data, 4.0f / (float) fftSize, numBins);
+}
+
+void SpectrumAnalyser::publishFrame (float level)
+{
+    const auto hopSeconds = (double) hopSize / currentSampleRate;
+    const auto averageCoefficient = (float) std::exp (-hopSeconds / averagingTime.load());
+    const auto peakCoefficient = juce::Decibels::decibelsToGain ((float) (-peakDecay.load() * hopSeconds));
+
+    auto* average = averageMagnitudes.data();
+    auto* peak = peakMagnitudes.data();
+    auto* post = postTap.magnitudes.data();
+
+    juce::FloatVectorOperations::multiply (average, averageCoefficient, numBins);
+    juce::FloatVectorOperations::addWithMultiply (average, post, 1.0f - averageCoefficient, numBins);
+
+    if (peakResetRequested.exchange (false))
+    {
+        juce::FloatVectorOperations::copy (peak, post, numBins);
+    }
+    else
+    {
+        juce::FloatVectorOperations::multiply (peak, peakCoefficient, numBins);
+        juce::FloatVectorOperations::max (peak, peak, post, numBins);
+    }
+
+    auto& frame = frames[(size_t) backIndex];
+
+    toDecibels (frame.pre.data(), preTap.magnitudes.data(), numBins);
+    toDecibels (frame.post.data(), post, numBins);
+    toDecibels (frame.peak.data(), peak, numBins);
+    toDecibels (frame.average.data(), average, numBins);
+    juce::FloatVectorOperations::subtract (frame.difference.data(), frame.post.data(), frame.pre.data(), numBins);
+
+    frame.sampleRate = currentSampleRate;
+    frame.postLevel = level;
+    frame.index = ++frameCounter;
+
+    backIndex = latestIndex.exchange (backIndex | newFrameFlag) & ~newFrameFlag;
+}
+
+void SpectrumAnalyser::toDecibels (float* dest, const float* magnitudes, int num)
+{
+    // Floor at -120 dB so the log never sees zero; the loop is simple enough to auto-vectorise
+    juce::FloatVectorOperations::max (dest, magnitudes, 1.0e-6f, num);
+
+    for (int i = 0; i < num; ++i)
+        dest[i] = 20.0f * std::log10 (dest[i]);
+}
@@ -0,0 +1,127 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyser.h
+    Created: 19 Oct 2026 9:42:59am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "ScopePyramid.h"
+#include "SharedResources.h"
+
+//==============================================================================
+/**
+    Pre/post EQ spectrum analyser.
+
+    The audio thread pushes the input and output of each block into lock-free
+    FIFOs. A background thread runs the FFTs and keeps the difference, peak-hold
+    and averaged traces, then publishes complete frames through a triple buffer
+    so the editor never does any analysis work in paint().
+*/
+class SpectrumAnalyser  : private juce::Thread
+{
+public:
+    static constexpr int fftOrder = SharedAnalysisTables::fftOrder;
+    static constexpr int fftSize = SharedAnalysisTables::fftSize;
+    static constexpr int numBins = fftSize / 2;
+
+    enum class ChannelMode
+    {
+        sum,
+        mid,
+        side
+    };
+
+    struct Frame
+    {
+        std::vector<float> pre, post, difference, peak, average;   // decibels, numBins each
+        double sampleRate = 0.0;
+        float postLevel = 0.0f;                                     // linear peak of the last hop
+        juce::uint32 index = 0;
+    };
+
+    SpectrumAnalyser();
+    ~SpectrumAnalyser() override;
+
+    //==============================================================================
+    void prepare (double sampleRate, int maximumBlockSize);
+    void release();
+
+    /** Audio thread: taps the signal before and after the EQ. */
+    void pushPre (const juce::AudioBuffer<float>& buffer);
+    void pushPost (const juce::AudioBuffer<float>& buffer);
+
+    //==============================================================================
+    void setChannelMode (ChannelMode newMode)           { channelMode = newMode; }
+    ChannelMode getChannelMode() const noexcept         { return channelMode; }
+
+    void setAveragingTime (float seconds)               { averagingTime = juce::jmax (0.01f, seconds); }
+    void setPeakDecay (float decibelsPerSecond)         { peakDecay = juce::jmax (0.0f, decibelsPerSecond); }
+    void resetPeakHold()                                { peakResetRequested = true; }
+
+    //==============================================================================
+    /** Message thread: swaps in the newest published frame.
+        Returns false if nothing new has been published since the last call.
+    */
+    bool pullLatestFrame();
+
+    /** The frame most recently swapped in by pullLatestFrame(). */
+    const Frame& getLatestFrame() const noexcept        { return frames[(size_t) frontIndex]; }
+
+    bool hasNewFrame() const noexcept                   { return (latestIndex.load() & newFrameFlag) != 0; }
+
+    /** Bytes held by the analyser's buffers, frames and scope history. */
+    size_t getMemoryUsage() const noexcept;
+
+    /** Min/max history of the post-EQ signal for the scope view. */
+    const ScopePyramid& getScope() const noexcept       { return scope; }
+
+private:
+    struct Tap
+    {
+        juce::AbstractFifo fifo { fftSize * 4 };
+        std::vector<float> samples;
+        std::vector<float> history;     // last fftSize samples, oldest first
+        std::vector<float> magnitudes;
+    };
+
+    void run() override;
+    int push (Tap&, const juce::AudioBuffer<float>&, int maxSamples);
+    void readHop (Tap&, int numSamples);
+    void analyse (Tap&);
+    void publishFrame (float level);
+
+    static void toDecibels (float* dest, const float* magnitudes, int num);
+
+    //==============================================================================
+    juce::SharedResourcePointer<SharedAnalysisTables> tables;
+    std::vector<float> fftBuffer;
+
+    Tap preTap, postTap;
+    std::vector<float> downmixBuffer;
+    int lastPreSamplesWritten = 0;
+
+    std::vector<float> peakMagnitudes, averageMagnitudes;
+    ScopePyramid scope;
+
+    static constexpr int newFrameFlag = 4;
+    std::array<Frame, 3> frames;
+    int backIndex = 0, frontIndex = 1;
+    std::atomic<int> latestIndex { 2 };
+    juce::uint32 frameCounter = 0;
+
+    double currentSampleRate = 44100.0;
+    int hopSize = fftSize / 4;
+
+    std::atomic<ChannelMode> channelMode { ChannelMode::sum };
+    std::atomic<float> averagingTime { 0.3f };
+    std::atomic<float> peakDecay { 12.0f };
+    std::atomic<bool> peakResetRequested { false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SpectrumAnalyser)
+};
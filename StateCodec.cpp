@@ -0,0 +1,114 @@
+/*
+  ==============================================================================
+
+    StateCodec.cpp
+    Created: 19 Oct 2026 9:48:00am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "StateCodec.h"
+
+//==============================================================================
+void ParameterTable::add (juce::uint16 stableID, juce::RangedAudioParameter* parameter)
+{
+    jassert (parameter != nullptr);
+
+    auto position = std::lower_bound (entries.begin(), entries.end(), stableID,
+                                      [] (const Entry& e, juce::uint16 id) { return e.stableID < id; });
+
+    // Two parameters sharing an ID would make old sessions ambiguous
+    jassert (position == entries.end() || position->stableID != stableID);
+
+    entries.insert (position, { stableID, parameter });
+}
+
+juce::RangedAudioParameter* ParameterTable::find (juce::uint16 stableID, int& hint) const noexcept
+{
+    if (juce::isPositiveAndBelow (hint, size()) && entries[(size_t) hint].stableID == stableID)
+        return entries[(size_t) hint++].parameter;
+
+    auto position = std::lower_bound (entries.begin(), entries.end(), stableID,
+                                      [] (const Entry& e, juce::uint16 id) { return e.stableID < id; });
+
+    if (position == entries.end() || position->stableID != stableID)
+        return nullptr;
+
+    hint = (int) std::distance (entries.begin(), position) + 1;
+    return position->parameter;
+}
+
+//==============================================================================
+namespace StateCodec
+{
+    void write (const ParameterTable& table, juce::MemoryBlock& destData)
+    {
+        const auto numEntries = table.size();
+
+        destData.setSize ((size_t) (headerSize + numEntries * entrySize));
+        juce::MemoryOutputStream out (destData, false);
+
+        out.writeInt ((int) magic);
+        out.writeShort ((short) currentVersion);
+        out.writeShort ((short) numEntries);
+        out.writeInt (numEntries * entrySize);
+
+        for (int i = 0; i < numEntries; ++i)
+        {
+            const auto& entry = table[i];
+            out.writeShort ((short) entry.stableID);
+            out.writeFloat (entry.parameter->convertFrom0to1 (entry.parameter->getValue()));
+        }
+    }
+
+    bool isBinaryState (const void* data, int sizeInBytes) noexcept
+    {
+        return data != nullptr
+            && sizeInBytes >= headerSize
+            && juce::ByteOrder::littleEndianInt (data) == magic;
+    }
+
+    bool read (const ParameterTable& table, const void* data, int sizeInBytes, ParameterBatch& batch)
+    {
+        if (! isBinaryState (data, sizeInBytes))
+            return false;
+
+        auto* bytes = static_cast<const char*> (data);
+        const auto version = juce::ByteOrder::littleEndianShort (bytes + 4);
+        const auto numEntries = (int) juce::ByteOrder::littleEndianShort (bytes + 6);
+        const auto payloadSize = (int) juce::ByteOrder::littleEndianInt (bytes + 8);
+
+        if (version > currentVersion || payloadSize != numEntries * entrySize
+             || sizeInBytes < headerSize + payloadSize)
+            return false;
+
+        auto* entry = bytes + headerSize;
+        int hint = 0;
+
+        for (int i = 0; i < numEntries; ++i, entry += entrySize)
+        {
+            const auto id = juce::ByteOrder::littleEndianShort (entry);
+
+            if (auto* parameter = table.find (id, hint))
+            {
+                auto bits = juce::ByteOrder::littleEndianInt (entry + 2);
+                float value;
+                std::memcpy (&value, &bits, sizeof (value));
+
+                batch.stage (parameter, value);
+            }
+        }
+
+        return true;
+    }
+
+    int getEndOfEntries (const void* data, int sizeInBytes) noexcept
+    {
+        if (! isBinaryState (data, sizeInBytes))
+            return sizeInBytes;
+
+        const auto payloadSize = (int) juce::ByteOrder::littleEndianInt (static_cast<const char*> (data) + 8);
+        return juce::jlimit (headerSize, sizeInBytes, headerSize + payloadSize);
+    }
+}
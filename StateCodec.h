@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    StateCodec.h
+    Created: 19 Oct 2026 9:48:00am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "ParameterBatch.h"
+
+//==============================================================================
+/**
+    Stable numeric parameter IDs used by the binary state format.
+    These are written to sessions, so never renumber an existing ID.
+*/
+namespace StableParameterID
+{
+    enum BandField : juce::uint16
+    {
+        frequency = 1,
+        gain      = 2,
+        Q         = 3,
+        type      = 4
+    };
+
+    enum Global : juce::uint16
+    {
+        globalGain = 0x0001,
+        mix        = 0x0002,
+        bypass     = 0x0003,
+        analyzer   = 0x0004,
+        morph      = 0x0005
+    };
+
+    /** Bands live at 0x0100, 0x0200... with the field in the low byte. */
+    constexpr juce::uint16 forBand (int band, BandField field)
+    {
+        return (juce::uint16) (((band + 1) << 8) | field);
+    }
+}
+
+//==============================================================================
+/** Maps stable numeric IDs to the processor's parameters. */
+class ParameterTable
+{
+public:
+    struct Entry
+    {
+        juce::uint16 stableID;
+        juce::RangedAudioParameter* parameter;
+    };
+
+    void add (juce::uint16 stableID, juce::RangedAudioParameter* parameter);
+
+    /** Looks up an ID, trying the slot after the previous hit first so that
+        reading entries in table order never has to search.
+    */
+    juce::RangedAudioParameter* find (juce::uint16 stableID, int& hint) const noexcept;
+
+    int size() const noexcept                               { return (int) entries.size(); }
+    const Entry& operator[] (int index) const noexcept      { return entries[(size_t) index]; }
+
+private:
+    std::vector<Entry> entries;   // sorted by stableID
+};
+
+//==============================================================================
+/**
+    Compact, versioned binary processor state.
+
+    A 12 byte header (magic, version, entry count, payload size) followed by
+    one { uint16 stableID, float32 plainValue } entry per parameter, all
+    little-endian. Restoring is a single pass with no parsing beyond that.
+*/
+namespace StateCodec
+{
+    constexpr juce::uint32 magic = 0x4251454a;   // "JEQB" as little-endian bytes
+    constexpr juce::uint16 currentVersion = 1;
+    constexpr int headerSize = 12;
+    constexpr int entrySize = 6;
+
+    void write (const ParameterTable&, juce::MemoryBlock& destData);
+
+    /** True if the data starts with the binary header; anything else should go to the XML path. */
+    bool isBinaryState (const void* data, int sizeInBytes) noexcept;
+
+    /** Stages every entry whose ID is known into the batch, skipping unknown ones.
+        Returns false if the data is truncated or from a newer version.
+    */
+    bool read (const ParameterTable&, const void* data, int sizeInBytes, ParameterBatch&);
+
+    /** Byte offset just past the last entry, where any trailing data starts. */
+    int getEndOfEntries (const void* data, int sizeInBytes) noexcept;
+}
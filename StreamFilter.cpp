@@ -0,0 +1,118 @@
+/*
+  ==============================================================================
+
+    StreamFilter.cpp
+    Created: 19 Oct 2026 10:07:46am
+    Author:  jarre
+
+    Console target: JarEQ as a filter in a shell pipeline.
+
+    Usage: StreamFilter [--preset <file>] [--rate <hz>] [--channels 1|2]
+                        [--format s16|s24|s32|f32] [--frames <samples>]
+                        [--buffer <frames>] [--listen <port>]
+
+    Reads PCM from stdin (or one TCP connection on localhost with --listen)
+    and writes the EQ'd PCM to stdout in fixed-size frames. A WAV stream is
+    detected by its header and its format used; otherwise the input is raw
+    interleaved little-endian PCM as described by the options.
+
+    kill -HUP reloads the preset file; the bands glide to the new settings
+    rather than jumping. Progress and errors go to stderr.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "StreamPipeline.h"
+#include "Constants.h"
+
+#include <csignal>
+
+namespace
+{
+    std::atomic<bool> reloadRequested { false }, stopRequested { false };
+
+    // Only lock-free atomics are safe to touch in a signal handler
+    extern "C" void handleHangup (int)      { reloadRequested = true; }
+    extern "C" void handleTerminate (int)   { stopRequested = true; }
+
+    bool parseSampleFormat (const juce::String& name, StreamPipeline::SampleFormat& result)
+    {
+        using SampleFormat = StreamPipeline::SampleFormat;
+
+        if      (name == "s16")  result = SampleFormat::int16;
+        else if (name == "s24")  result = SampleFormat::int24;
+        else if (name == "s32")  result = SampleFormat::int32;
+        else if (name == "f32")  result = SampleFormat::float32;
+        else                     return false;
+
+        return true;
+    }
+
+    int fail (const juce::String& message)
+    {
+        std::cerr << message << std::endl;
+        return 1;
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    juce::ArgumentList args (argc, argv);
+
+    StreamPipeline::Settings settings;
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        auto& arg = args[i];
+        auto next = [&] { return i + 1 < args.size() ? args[++i].text : juce::String(); };
+
+        if      (arg == "--preset")    settings.presetFile = juce::File::getCurrentWorkingDirectory().getChildFile (next());
+        else if (arg == "--rate")      settings.rawFormat.sampleRate = juce::jlimit (8000.0, maxSupportedSampleRate, next().getDoubleValue());
+        else if (arg == "--channels")  settings.rawFormat.numChannels = next().getIntValue();
+        else if (arg == "--frames")    settings.frameSize = juce::jlimit (16, 8192, next().getIntValue());
+        else if (arg == "--buffer")    settings.bufferFrames = juce::jlimit (2, 4096, next().getIntValue());
+        else if (arg == "--listen")    settings.listenPort = juce::jlimit (0, 65535, next().getIntValue());
+        else if (arg == "--format")
+        {
+            if (! parseSampleFormat (next(), settings.rawFormat.sampleFormat))
+                return fail ("Unknown sample format; use s16, s24, s32 or f32");
+        }
+        else
+        {
+            return fail ("Usage: StreamFilter [--preset file] [--rate hz] [--channels 1|2] [--format s16|s24|s32|f32] "
+                         "[--frames n] [--buffer n] [--listen port]");
+        }
+    }
+
+    // Let a closed pipe show up as a write error instead of killing the process
+    std::signal (SIGPIPE, SIG_IGN);
+    std::signal (SIGHUP, handleHangup);
+    std::signal (SIGINT, handleTerminate);
+    std::signal (SIGTERM, handleTerminate);
+
+    StreamPipeline pipeline (settings);
+
+    // The flag also gets start() out of waiting for a connection or the first input
+    if (auto started = pipeline.start (&stopRequested); started.failed())
+        return stopRequested ? 0 : fail (started.getErrorMessage());
+
+    const auto& format = pipeline.getFormat();
+    std::cerr << "JarEQ streaming " << format.numChannels << " ch at " << format.sampleRate << " Hz"
+              << (pipeline.isWavStream() ? " (WAV)" : " (raw)") << std::endl;
+
+    while (pipeline.isRunning() && ! stopRequested)
+    {
+        if (reloadRequested.exchange (false))
+        {
+            auto reloaded = pipeline.reloadPreset();
+            std::cerr << (reloaded.wasOk() ? juce::String ("Preset reloaded") : reloaded.getErrorMessage()) << std::endl;
+        }
+
+        juce::Thread::sleep (20);
+    }
+
+    pipeline.stop();
+    return 0;
+}
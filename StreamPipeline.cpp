@@ -0,0 +1,587 @@
+/*
+  ==============================================================================
+
+    StreamPipeline.cpp
+    Created: 19 Oct 2026 10:07:46am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "StreamPipeline.h"
+#include "PluginProcessor.h"
+#include "Constants.h"
+
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+
+namespace
+{
+    constexpr int pollIntervalMs = 100;
+
+    /** A PRESET tree goes through applyPreset(), anything else through setStateInformation();
+        both land as one parameter batch.
+    */
+    juce::Result applyPresetFile (JarEQAudioProcessor& processor, const juce::File& file)
+    {
+        juce::MemoryBlock data;
+
+        if (! file.loadFileAsData (data) || data.isEmpty())
+            return juce::Result::fail ("Can't read preset " + file.getFullPathName());
+
+        if (auto xml = juce::parseXML (data.toString()); xml != nullptr && xml->hasTagName ("PRESET"))
+        {
+            processor.applyPreset (juce::ValueTree::fromXml (*xml));
+            return juce::Result::ok();
+        }
+
+        if (StateCodec::isBinaryState (data.getData(), (int) data.getSize())
+             || juce::AudioProcessor::getXmlFromBinary (data.getData(), (int) data.getSize()) != nullptr)
+        {
+            processor.setStateInformation (data.getData(), (int) data.getSize());
+            return juce::Result::ok();
+        }
+
+        return juce::Result::fail ("Not a JarEQ preset or state: " + file.getFullPathName());
+    }
+
+    bool writeAll (const char* data, int numBytes)
+    {
+        while (numBytes > 0)
+        {
+            const auto written = ::write (STDOUT_FILENO, data, (size_t) numBytes);
+
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+
+                return false;   // e.g. the next tool in the pipe has gone
+            }
+
+            data += written;
+            numBytes -= (int) written;
+        }
+
+        return true;
+    }
+
+    juce::uint16 readShort (const char* p) noexcept     { return juce::ByteOrder::littleEndianShort (p); }
+    juce::uint32 readInt (const char* p) noexcept       { return juce::ByteOrder::littleEndianInt (p); }
+}
+
+//==============================================================================
+int StreamPipeline::Format::getBytesPerSample() const noexcept
+{
+    switch (sampleFormat)
+    {
+        case SampleFormat::int16:   return 2;
+        case SampleFormat::int24:   return 3;
+        case SampleFormat::int32:
+        case SampleFormat::float32: return 4;
+    }
+
+    return 2;
+}
+
+//==============================================================================
+StreamPipeline::ByteRing::ByteRing (int capacity)
+    : fifo (capacity), bytes ((size_t) capacity)
+{
+}
+
+int StreamPipeline::ByteRing::write (const void* data, int numBytes) noexcept
+{
+    auto* source = static_cast<const char*> (data);
+    const auto scope = fifo.write (numBytes);
+
+    if (scope.blockSize1 > 0)
+        std::memcpy (bytes + scope.startIndex1, source, (size_t) scope.blockSize1);
+
+    if (scope.blockSize2 > 0)
+        std::memcpy (bytes + scope.startIndex2, source + scope.blockSize1, (size_t) scope.blockSize2);
+
+    return scope.blockSize1 + scope.blockSize2;
+}
+
+int StreamPipeline::ByteRing::read (void* dest, int numBytes) noexcept
+{
+    auto* target = static_cast<char*> (dest);
+    const auto scope = fifo.read (numBytes);
+
+    if (scope.blockSize1 > 0)
+        std::memcpy (target, bytes + scope.startIndex1, (size_t) scope.blockSize1);
+
+    if (scope.blockSize2 > 0)
+        std::memcpy (target + scope.blockSize1, bytes + scope.startIndex2, (size_t) scope.blockSize2);
+
+    return scope.blockSize1 + scope.blockSize2;
+}
+
+//==============================================================================
+StreamPipeline::StreamPipeline (const Settings& s)
+    : settings (s), format (s.rawFormat)
+{
+}
+
+StreamPipeline::~StreamPipeline()
+{
+    stop();
+}
+
+juce::Result StreamPipeline::start (const std::atomic<bool>* stopFlag)
+{
+    externalStop = stopFlag;
+
+    if (settings.listenPort > 0)
+    {
+        listener = std::make_unique<juce::StreamingSocket>();
+
+        if (! listener->createListener (settings.listenPort, "127.0.0.1"))
+            return juce::Result::fail ("Can't listen on port " + juce::String (settings.listenPort));
+
+        if (! waitForConnection())
+            return juce::Result::fail ("No connection on port " + juce::String (settings.listenPort));
+    }
+
+    juce::MemoryBlock leftover;
+
+    if (auto header = readWavHeader (leftover); header.failed())
+        return header;
+
+    if (format.numChannels < 1 || format.numChannels > 2)
+        return juce::Result::fail ("Only mono and stereo streams are supported");
+
+    processor = std::make_unique<JarEQAudioProcessor>();
+    processor->setPlayConfigDetails (2, 2, format.sampleRate, settings.frameSize);
+
+    if (settings.presetFile != juce::File())
+        if (auto loaded = applyPresetFile (*processor, settings.presetFile); loaded.failed())
+            return loaded;
+
+    processor->prepareToPlay (format.sampleRate, settings.frameSize);
+
+    const auto ringBytes = settings.frameSize * format.getBytesPerFrame() * juce::jmax (2, settings.bufferFrames);
+    inputRing = std::make_unique<ByteRing> (ringBytes);
+    outputRing = std::make_unique<ByteRing> (ringBytes);
+
+    // Bytes read while sniffing for a header are the start of a raw stream
+    inputRing->write (leftover.getData(), (int) leftover.getSize());
+    pushOutputHeader();
+
+    running = true;
+
+    reader          = std::make_unique<Worker> ("JarEQ stream reader",    [this] (Worker& t) { runReader (t); });
+    processorThread = std::make_unique<Worker> ("JarEQ stream processor", [this] (Worker& t) { runProcessor (t); });
+    writer          = std::make_unique<Worker> ("JarEQ stream writer",    [this] (Worker& t) { runWriter (t); });
+
+    reader->startThread();
+    processorThread->startThread (juce::Thread::Priority::high);
+    writer->startThread();
+
+    return juce::Result::ok();
+}
+
+void StreamPipeline::stop()
+{
+    for (auto* thread : { reader.get(), processorThread.get(), writer.get() })
+        if (thread != nullptr)
+            thread->signalThreadShouldExit();
+
+    for (auto* thread : { reader.get(), processorThread.get(), writer.get() })
+        if (thread != nullptr)
+            thread->stopThread (2000);
+
+    if (processor != nullptr)
+        processor->releaseResources();
+
+    running = false;
+}
+
+juce::Result StreamPipeline::reloadPreset()
+{
+    if (processor == nullptr || settings.presetFile == juce::File())
+        return juce::Result::fail ("No preset to reload");
+
+    return applyPresetFile (*processor, settings.presetFile);
+}
+
+//==============================================================================
+bool StreamPipeline::shouldStopReading() const noexcept
+{
+    return (reader != nullptr && reader->threadShouldExit())
+        || (externalStop != nullptr && externalStop->load());
+}
+
+bool StreamPipeline::waitForConnection()
+{
+    // waitForNextConnection() blocks in accept(), so only call it once one is pending
+    for (;;)
+    {
+        if (shouldStopReading())
+            return false;
+
+        pollfd descriptor { listener->getRawSocketHandle(), POLLIN, 0 };
+        const auto ready = ::poll (&descriptor, 1, pollIntervalMs);
+
+        if (ready < 0 && errno != EINTR)
+            return false;
+
+        if (ready > 0)
+        {
+            connection.reset (listener->waitForNextConnection());
+            return connection != nullptr;
+        }
+    }
+}
+
+int StreamPipeline::readInput (void* dest, int maxBytes)
+{
+    // Poll first so a blocked read can't keep the reader from noticing stop(),
+    // or start() from noticing the stop flag before any input has arrived
+    for (;;)
+    {
+        if (shouldStopReading())
+            return 0;
+
+        if (connection != nullptr)
+        {
+            const auto ready = connection->waitUntilReady (true, pollIntervalMs);
+
+            if (ready < 0)
+                return 0;
+
+            if (ready > 0)
+                return juce::jmax (0, connection->read (dest, maxBytes, false));
+
+            continue;
+        }
+
+        pollfd descriptor { STDIN_FILENO, POLLIN, 0 };
+        const auto ready = ::poll (&descriptor, 1, pollIntervalMs);
+
+        if (ready < 0 && errno != EINTR)
+            return 0;
+
+        if (ready > 0)
+        {
+            const auto numRead = ::read (STDIN_FILENO, dest, (size_t) maxBytes);
+
+            if (numRead >= 0)
+                return (int) numRead;
+
+            if (errno != EINTR && errno != EAGAIN)
+                return 0;
+        }
+    }
+}
+
+bool StreamPipeline::readExactly (void* dest, int numBytes)
+{
+    auto* target = static_cast<char*> (dest);
+
+    while (numBytes > 0)
+    {
+        const auto numRead = readInput (target, numBytes);
+
+        if (numRead <= 0)
+            return false;
+
+        target += numRead;
+        numBytes -= numRead;
+    }
+
+    return true;
+}
+
+juce::Result StreamPipeline::readWavHeader (juce::MemoryBlock& leftover)
+{
+    char riff[12];
+
+    if (! readExactly (riff, 4))
+        return juce::Result::fail ("No input");
+
+    if (std::memcmp (riff, "RIFF", 4) != 0)
+    {
+        leftover.append (riff, 4);
+        return juce::Result::ok();
+    }
+
+    if (! readExactly (riff + 4, 8) || std::memcmp (riff + 8, "WAVE", 4) != 0)
+        return juce::Result::fail ("Not a WAV stream");
+
+    // Walk the chunks in order; the input can't seek, so anything else is skipped by reading it
+    bool foundFormat = false;
+
+    for (;;)
+    {
+        char chunk[8];
+
+        if (! readExactly (chunk, 8))
+            return juce::Result::fail ("WAV stream ended before its data");
+
+        const auto size = (int) juce::jmin ((juce::uint32) 0x7fffffff, readInt (chunk + 4));
+
+        if (std::memcmp (chunk, "data", 4) == 0)
+            break;
+
+        // Chunks are padded to an even size
+        const auto paddedSize = size + (size & 1);
+
+        if (std::memcmp (chunk, "fmt ", 4) != 0 || size < 16)
+        {
+            char skipped[256];
+
+            for (int remaining = paddedSize; remaining > 0; remaining -= (int) sizeof (skipped))
+                if (! readExactly (skipped, juce::jmin (remaining, (int) sizeof (skipped))))
+                    return juce::Result::fail ("Truncated WAV header");
+
+            continue;
+        }
+
+        juce::HeapBlock<char> body ((size_t) paddedSize);
+
+        if (! readExactly (body, paddedSize))
+            return juce::Result::fail ("Truncated WAV header");
+
+        auto tag = readShort (body);
+        const auto bits = readShort (body + 14);
+
+        // WAVE_FORMAT_EXTENSIBLE keeps the real tag at the start of its sub-format GUID
+        if (tag == 0xfffe && size >= 26)
+            tag = readShort (body + 24);
+
+        format.numChannels = readShort (body + 2);
+        format.sampleRate = (double) readInt (body + 4);
+
+        if (tag == 1 && bits == 16)       format.sampleFormat = SampleFormat::int16;
+        else if (tag == 1 && bits == 24)  format.sampleFormat = SampleFormat::int24;
+        else if (tag == 1 && bits == 32)  format.sampleFormat = SampleFormat::int32;
+        else if (tag == 3 && bits == 32)  format.sampleFormat = SampleFormat::float32;
+        else                              return juce::Result::fail ("Unsupported WAV sample format");
+
+        // The header goes straight into prepareToPlay, so hold it to the same limits as the options
+        if (format.numChannels < 1 || format.numChannels > 2)
+            return juce::Result::fail ("Only mono and stereo WAV streams are supported");
+
+        if (format.sampleRate < 8000.0 || format.sampleRate > maxSupportedSampleRate)
+            return juce::Result::fail ("Unsupported WAV sample rate " + juce::String (format.sampleRate));
+
+        foundFormat = true;
+    }
+
+    if (! foundFormat)
+        return juce::Result::fail ("WAV stream has no fmt chunk");
+
+    wavStream = true;
+    return juce::Result::ok();
+}
+
+void StreamPipeline::pushOutputHeader()
+{
+    if (! wavStream)
+        return;
+
+    // Sizes are unknown while streaming, so they're left at their maximum
+    juce::MemoryOutputStream header;
+    const auto blockAlign = format.getBytesPerFrame();
+
+    header.write ("RIFF", 4);
+    header.writeInt (-1);
+    header.write ("WAVEfmt ", 8);
+    header.writeInt (16);
+    header.writeShort (format.sampleFormat == SampleFormat::float32 ? 3 : 1);
+    header.writeShort ((short) format.numChannels);
+    header.writeInt ((int) format.sampleRate);
+    header.writeInt ((int) format.sampleRate * blockAlign);
+    header.writeShort ((short) blockAlign);
+    header.writeShort ((short) (format.getBytesPerSample() * 8));
+    header.write ("data", 4);
+    header.writeInt (-1);
+
+    outputRing->write (header.getData(), (int) header.getDataSize());
+}
+
+//==============================================================================
+void StreamPipeline::runReader (Worker& thread)
+{
+    const auto chunkBytes = settings.frameSize * format.getBytesPerFrame();
+    juce::HeapBlock<char> chunk ((size_t) chunkBytes);
+
+    while (! thread.threadShouldExit())
+    {
+        const auto numRead = readInput (chunk, chunkBytes);
+
+        if (numRead <= 0)
+            break;
+
+        for (int written = 0; written < numRead && ! thread.threadShouldExit();)
+        {
+            written += inputRing->write (chunk + written, numRead - written);
+            inputRing->dataReady.signal();
+
+            if (written < numRead)
+                inputRing->spaceFreed.wait (pollIntervalMs);
+        }
+    }
+
+    inputFinished = true;
+    inputRing->dataReady.signal();
+}
+
+void StreamPipeline::runProcessor (Worker& thread)
+{
+    const auto bytesPerFrame = format.getBytesPerFrame();
+    const auto frameBytes = settings.frameSize * bytesPerFrame;
+
+    juce::HeapBlock<char> inBytes ((size_t) frameBytes), outBytes ((size_t) frameBytes);
+    juce::AudioBuffer<float> buffer (2, settings.frameSize);
+    juce::MidiBuffer midi;
+
+    while (! thread.threadShouldExit())
+    {
+        const auto finished = inputFinished.load();
+        const auto ready = inputRing->getNumReady();
+
+        // Whole frames only, except for the tail of the stream
+        if (ready < frameBytes && ! finished)
+        {
+            inputRing->dataReady.wait (pollIntervalMs);
+            continue;
+        }
+
+        const auto numSamples = juce::jmin (ready, frameBytes) / bytesPerFrame;
+
+        if (numSamples == 0)
+            break;
+
+        const auto numBytes = numSamples * bytesPerFrame;
+        inputRing->read (inBytes, numBytes);
+        inputRing->spaceFreed.signal();
+
+        juce::AudioBuffer<float> block (buffer.getArrayOfWritePointers(), 2, 0, numSamples);
+        decode (inBytes, block, numSamples);
+        processor->processBlock (block, midi);
+        encode (block, outBytes, numSamples);
+
+        for (int written = 0; written < numBytes && ! thread.threadShouldExit();)
+        {
+            written += outputRing->write (outBytes + written, numBytes - written);
+            outputRing->dataReady.signal();
+
+            if (written < numBytes)
+                outputRing->spaceFreed.wait (pollIntervalMs);
+        }
+    }
+
+    processingFinished = true;
+    outputRing->dataReady.signal();
+}
+
+void StreamPipeline::runWriter (Worker& thread)
+{
+    const auto chunkBytes = settings.frameSize * format.getBytesPerFrame();
+    juce::HeapBlock<char> chunk ((size_t) chunkBytes);
+
+    while (! thread.threadShouldExit())
+    {
+        // Check before reading, so nothing written after the last read is missed
+        const auto finished = processingFinished.load();
+        const auto numRead = outputRing->read (chunk, chunkBytes);
+
+        if (numRead > 0)
+        {
+            outputRing->spaceFreed.signal();
+
+            if (! writeAll (chunk, numRead))
+                break;
+
+            continue;
+        }
+
+        if (finished)
+            break;
+
+        outputRing->dataReady.wait (pollIntervalMs);
+    }
+
+    running = false;
+}
+
+//==============================================================================
+void StreamPipeline::decode (const char* source, juce::AudioBuffer<float>& dest, int numSamples) const noexcept
+{
+    const auto numChannels = format.numChannels;
+    const auto bytesPerSample = format.getBytesPerSample();
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        auto* samples = dest.getWritePointer (channel);
+        auto* p = source + channel * bytesPerSample;
+
+        for (int i = 0; i < numSamples; ++i, p += numChannels * bytesPerSample)
+        {
+            switch (format.sampleFormat)
+            {
+                case SampleFormat::int16:   samples[i] = (float) (juce::int16) readShort (p) * (1.0f / 32768.0f); break;
+                case SampleFormat::int24:   samples[i] = (float) juce::ByteOrder::littleEndian24Bit (p) * (1.0f / 8388608.0f); break;
+                case SampleFormat::int32:   samples[i] = (float) ((double) (juce::int32) readInt (p) * (1.0 / 2147483648.0)); break;
+                case SampleFormat::float32:
+                {
+                    const auto bits = readInt (p);
+                    std::memcpy (samples + i, &bits, sizeof (float));
+                    break;
+                }
+            }
+        }
+    }
+
+    // The engine always runs stereo; mono streams are fed as a duplicated pair
+    if (numChannels == 1)
+        dest.copyFrom (1, 0, dest, 0, 0, numSamples);
+}
+
+void StreamPipeline::encode (const juce::AudioBuffer<float>& source, char* dest, int numSamples) const noexcept
+{
+    const auto numChannels = format.numChannels;
+    const auto bytesPerSample = format.getBytesPerSample();
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        auto* samples = source.getReadPointer (channel);
+        auto* p = dest + channel * bytesPerSample;
+
+        for (int i = 0; i < numSamples; ++i, p += numChannels * bytesPerSample)
+        {
+            const auto clipped = (double) juce::jlimit (-1.0f, 1.0f, samples[i]);
+
+            switch (format.sampleFormat)
+            {
+                case SampleFormat::int16:
+                {
+                    const auto value = juce::ByteOrder::swapIfBigEndian ((juce::uint16) (juce::int16) juce::jlimit (-32768, 32767, juce::roundToInt (clipped * 32768.0)));
+                    std::memcpy (p, &value, 2);
+                    break;
+                }
+                case SampleFormat::int24:
+                    juce::ByteOrder::littleEndian24BitToChars (juce::jlimit (-8388608, 8388607, juce::roundToInt (clipped * 8388608.0)), p);
+                    break;
+                case SampleFormat::int32:
+                {
+                    const auto value = juce::ByteOrder::swapIfBigEndian ((juce::uint32) (juce::int32) juce::jlimit (-2147483648.0, 2147483647.0, std::round (clipped * 2147483648.0)));
+                    std::memcpy (p, &value, 4);
+                    break;
+                }
+                case SampleFormat::float32:
+                {
+                    juce::uint32 bits;
+                    std::memcpy (&bits, samples + i, sizeof (float));
+                    bits = juce::ByteOrder::swapIfBigEndian (bits);
+                    std::memcpy (p, &bits, 4);
+                    break;
+                }
+            }
+        }
+    }
+}
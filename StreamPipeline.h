@@ -0,0 +1,136 @@
+/*
+  ==============================================================================
+
+    StreamPipeline.h
+    Created: 19 Oct 2026 10:07:46am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+class JarEQAudioProcessor;
+
+//==============================================================================
+/**
+    Filters a PCM byte stream through JarEQ for use in a shell pipeline.
+
+    Three threads are joined by single-producer, single-consumer byte rings:
+    the reader pulls input as it arrives, the processor turns it into
+    fixed-size frames for processBlock(), and the writer drains output to
+    stdout. None of them ever waits on a lock held by another.
+
+    The input is a WAV stream (detected by its RIFF header, and echoed on the
+    output with open-ended sizes) or raw interleaved little-endian PCM in
+    the configured format.
+*/
+class StreamPipeline
+{
+public:
+    enum class SampleFormat { int16, int24, int32, float32 };
+
+    struct Format
+    {
+        double sampleRate = 48000.0;
+        int numChannels = 2;
+        SampleFormat sampleFormat = SampleFormat::int16;
+
+        int getBytesPerSample() const noexcept;
+        int getBytesPerFrame() const noexcept       { return getBytesPerSample() * numChannels; }
+    };
+
+    struct Settings
+    {
+        juce::File presetFile;          // optional; .jeqpreset/XML preset or a state blob
+        Format rawFormat;               // used unless the input starts with a WAV header
+        int frameSize = 256;            // samples per processBlock() call and per output write
+        int bufferFrames = 16;          // capacity of each ring, in frames
+        int listenPort = 0;             // > 0 reads from a TCP connection on localhost instead of stdin
+    };
+
+    explicit StreamPipeline (const Settings&);
+    ~StreamPipeline();
+
+    /** Opens the input, reads any WAV header, loads the preset and starts the threads.
+
+        Waiting for a connection or for the first bytes can take forever, so if a
+        stop flag is given, start() gives up once it is set, e.g. from a signal
+        handler. The reader also finishes when it is set, letting the output drain.
+    */
+    juce::Result start (const std::atomic<bool>* stopFlag = nullptr);
+
+    /** Stops early; otherwise the pipeline runs until the input ends and the output is written. */
+    void stop();
+
+    bool isRunning() const noexcept             { return running; }
+
+    /** Reads the preset file again and applies it as one batch, so the bands glide
+        to the new settings through the processor's smoothing. Message/main thread.
+    */
+    juce::Result reloadPreset();
+
+    const Format& getFormat() const noexcept    { return format; }
+    bool isWavStream() const noexcept           { return wavStream; }
+
+private:
+    //==============================================================================
+    /** A lock-free single-producer, single-consumer byte ring. */
+    class ByteRing
+    {
+    public:
+        explicit ByteRing (int capacity);
+
+        int write (const void* data, int numBytes) noexcept;
+        int read (void* dest, int numBytes) noexcept;
+        int getNumReady() const noexcept        { return fifo.getNumReady(); }
+
+        juce::WaitableEvent dataReady, spaceFreed;
+
+    private:
+        juce::AbstractFifo fifo;
+        juce::HeapBlock<char> bytes;
+    };
+
+    class Worker  : public juce::Thread
+    {
+    public:
+        Worker (const juce::String& name, std::function<void (Worker&)> bodyToRun)
+            : juce::Thread (name), body (std::move (bodyToRun)) {}
+
+        void run() override                     { body (*this); }
+
+    private:
+        std::function<void (Worker&)> body;
+    };
+
+    bool shouldStopReading() const noexcept;
+    bool waitForConnection();
+    int readInput (void* dest, int maxBytes);
+    bool readExactly (void* dest, int numBytes);
+    juce::Result readWavHeader (juce::MemoryBlock& leftover);
+    void pushOutputHeader();
+
+    void runReader (Worker&);
+    void runProcessor (Worker&);
+    void runWriter (Worker&);
+
+    void decode (const char* source, juce::AudioBuffer<float>& dest, int numSamples) const noexcept;
+    void encode (const juce::AudioBuffer<float>& source, char* dest, int numSamples) const noexcept;
+
+    Settings settings;
+    Format format;
+    bool wavStream = false;
+
+    std::unique_ptr<juce::StreamingSocket> listener, connection;
+    std::unique_ptr<JarEQAudioProcessor> processor;
+    std::unique_ptr<ByteRing> inputRing, outputRing;
+    std::unique_ptr<Worker> reader, processorThread, writer;
+
+    std::atomic<bool> running { false }, inputFinished { false }, processingFinished { false };
+    const std::atomic<bool>* externalStop = nullptr;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (StreamPipeline)
+};
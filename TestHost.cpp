@@ -0,0 +1,247 @@
+/*
+  ==============================================================================
+
+    TestHost.cpp
+    Created: 19 Oct 2026 10:16:40am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "TestHost.h"
+
+#ifndef JAREQ_TEST_HOST_COUNTS_ALLOCATIONS
+ #define JAREQ_TEST_HOST_COUNTS_ALLOCATIONS 1
+#endif
+
+namespace
+{
+    // Only allocations made by the thread currently inside processBlock are counted
+    std::atomic<void*> countedThread { nullptr };
+    std::atomic<int> allocationCount { 0 };
+
+    inline void noteAllocation() noexcept
+    {
+        if (countedThread.load (std::memory_order_relaxed) == juce::Thread::getCurrentThreadId())
+            allocationCount.fetch_add (1, std::memory_order_relaxed);
+    }
+}
+
+//==============================================================================
+// On glibc malloc itself is interposed, which also catches operator new and
+// JUCE's HeapBlock. Elsewhere only operator new is replaced, so allocations
+// straight from malloc and over-aligned news aren't seen.
+#if JAREQ_TEST_HOST_COUNTS_ALLOCATIONS && defined (__GLIBC__)
+
+extern "C"
+{
+    void* __libc_malloc (size_t);
+    void* __libc_calloc (size_t, size_t);
+    void* __libc_realloc (void*, size_t);
+
+    void* malloc (size_t size) noexcept                     { noteAllocation(); return __libc_malloc (size); }
+    void* calloc (size_t count, size_t size) noexcept       { noteAllocation(); return __libc_calloc (count, size); }
+    void* realloc (void* block, size_t size) noexcept       { noteAllocation(); return __libc_realloc (block, size); }
+}
+
+#elif JAREQ_TEST_HOST_COUNTS_ALLOCATIONS
+
+void* operator new (std::size_t size)
+{
+    noteAllocation();
+
+    if (auto* block = std::malloc (size == 0 ? 1 : size))
+        return block;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[] (std::size_t size)                     { return operator new (size); }
+void operator delete (void* block) noexcept                 { std::free (block); }
+void operator delete[] (void* block) noexcept               { std::free (block); }
+void operator delete (void* block, std::size_t) noexcept    { std::free (block); }
+void operator delete[] (void* block, std::size_t) noexcept  { std::free (block); }
+
+#endif
+
+bool TestHost::isCountingAllocations() noexcept
+{
+    return JAREQ_TEST_HOST_COUNTS_ALLOCATIONS != 0;
+}
+
+//==============================================================================
+void TestHost::Script::addRamp (int parameterIndex, juce::int64 start, juce::int64 end, float from, float to, int numPoints)
+{
+    numPoints = juce::jmax (2, numPoints);
+
+    for (int i = 0; i < numPoints; ++i)
+    {
+        const auto proportion = (double) i / (double) (numPoints - 1);
+
+        automation.push_back ({ start + (juce::int64) ((double) (end - start) * proportion),
+                                parameterIndex,
+                                from + (to - from) * (float) proportion });
+    }
+}
+
+std::vector<int> TestHost::makeRandomBlockSizes (int count, int minSize, int maxSize, juce::int64 seed)
+{
+    juce::Random random (seed);
+    std::vector<int> sizes ((size_t) juce::jmax (1, count));
+
+    for (auto& size : sizes)
+        size = random.nextInt ({ juce::jmax (1, minSize), juce::jmax (minSize, maxSize) + 1 });
+
+    return sizes;
+}
+
+//==============================================================================
+int TestHost::Run::getTotalAllocations() const noexcept
+{
+    int total = 0;
+
+    for (auto& block : blocks)
+        total += juce::jmax (0, block.allocations);
+
+    return total;
+}
+
+bool TestHost::Run::allRoundTripsMatched() const noexcept
+{
+    return std::all_of (roundTrips.begin(), roundTrips.end(), [] (const RoundTripRecord& r) { return r.stateMatched; });
+}
+
+double TestHost::Run::getWorstDeadlineRatio (double sampleRate) const noexcept
+{
+    double worst = 0.0;
+
+    for (auto& block : blocks)
+        worst = juce::jmax (worst, block.seconds * sampleRate / (double) block.numSamples);
+
+    return worst;
+}
+
+double TestHost::Run::getRealtime (double sampleRate) const noexcept
+{
+    double seconds = 0.0;
+
+    for (auto& block : blocks)
+        seconds += block.seconds;
+
+    return (double) output.getNumSamples() / sampleRate / juce::jmax (1.0e-12, seconds);
+}
+
+//==============================================================================
+TestHost::TestHost (Settings s)
+    : settings (s),
+      processor (std::make_unique<JarEQAudioProcessor>())
+{
+}
+
+TestHost::~TestHost()
+{
+}
+
+TestHost::Run TestHost::run (const juce::AudioBuffer<float>& input, const Script& script)
+{
+    // The processor's mix stage only knows about stereo
+    jassert (input.getNumChannels() == 2);
+    jassert (! script.blockSizes.empty());
+
+    auto& p = *processor;
+    const auto numSamples = (juce::int64) input.getNumSamples();
+    const auto& parameters = p.getParameters();
+    auto& events = p.getParameterEventQueue();
+
+    auto automation = script.automation;
+    std::stable_sort (automation.begin(), automation.end(), [] (const Automation& a, const Automation& b) { return a.position < b.position; });
+
+    auto roundTrips = script.stateRoundTrips;
+    std::sort (roundTrips.begin(), roundTrips.end());
+
+    Run result;
+    result.output.setSize (2, input.getNumSamples());
+
+    juce::AudioBuffer<float> block (2, settings.maxBlockSize);
+    juce::MidiBuffer midi;
+
+    auto roundTripState = [&p] (juce::int64 position)
+    {
+        juce::MemoryBlock saved, restored;
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        p.getStateInformation (saved);
+        p.setStateInformation (saved.getData(), (int) saved.getSize());
+        p.getStateInformation (restored);
+
+        const auto seconds = juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - start);
+        return RoundTripRecord { position, saved.getSize(), saved == restored, seconds };
+    };
+
+    p.setPlayConfigDetails (2, 2, settings.sampleRate, settings.maxBlockSize);
+    p.prepareToPlay (settings.sampleRate, settings.maxBlockSize);
+
+    size_t nextPoint = 0, nextRoundTrip = 0;
+
+    for (juce::int64 position = 0, blockIndex = 0; position < numSamples; ++blockIndex)
+    {
+        const auto scripted = script.blockSizes[(size_t) (blockIndex % (juce::int64) script.blockSizes.size())];
+        jassert (juce::isPositiveAndNotGreaterThan (scripted, settings.maxBlockSize));
+
+        const auto num = (int) juce::jmin ((juce::int64) juce::jlimit (1, settings.maxBlockSize, scripted), numSamples - position);
+        const auto end = position + num;
+
+        // Saving and restoring happens between callbacks, like a host's message thread
+        for (; nextRoundTrip < roundTrips.size() && roundTrips[nextRoundTrip] < end; ++nextRoundTrip)
+            result.roundTrips.push_back (roundTripState (position));
+
+        // Points at the block's start are in the parameters before the callback and later
+        // ones after it, so a state saved between blocks holds what has been played.
+        // Set without notifying, or each change would be queued again at offset 0
+        auto setParameters = [&] (size_t first, size_t last, bool atStart)
+        {
+            for (auto i = first; i < last; ++i)
+                if (auto* parameter = parameters[automation[i].parameterIndex])
+                    if ((automation[i].position <= position) == atStart)
+                        parameter->setValue (automation[i].normalisedValue);
+        };
+
+        const auto firstPoint = nextPoint;
+
+        for (; nextPoint < automation.size() && automation[nextPoint].position < end; ++nextPoint)
+        {
+            const auto& point = automation[nextPoint];
+            events.push (point.parameterIndex, (int) juce::jmax ((juce::int64) 0, point.position - position), point.normalisedValue);
+        }
+
+        setParameters (firstPoint, nextPoint, true);
+
+        block.setSize (2, num, false, false, true);
+
+        for (int channel = 0; channel < 2; ++channel)
+            block.copyFrom (channel, 0, input, channel, (int) position, num);
+
+        allocationCount = 0;
+        countedThread = juce::Thread::getCurrentThreadId();
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        p.processBlock (block, midi);
+
+        const auto finish = juce::Time::getHighResolutionTicks();
+        countedThread = nullptr;
+
+        setParameters (firstPoint, nextPoint, false);
+
+        result.blocks.push_back ({ position, num,
+                                   juce::Time::highResolutionTicksToSeconds (finish - start),
+                                   isCountingAllocations() ? allocationCount.load() : -1 });
+
+        for (int channel = 0; channel < 2; ++channel)
+            result.output.copyFrom (channel, (int) position, block, channel, 0, num);
+
+        position = end;
+    }
+
+    p.releaseResources();
+    return result;
+}
@@ -0,0 +1,113 @@
+/*
+  ==============================================================================
+
+    TestHost.h
+    Created: 19 Oct 2026 10:16:40am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+//==============================================================================
+/**
+    Runs a JarEQAudioProcessor in-process the way a host would, without a DAW
+    or audio hardware, from a script of block sizes, automation and state
+    round-trips.
+
+    Automation is delivered like a sample-accurate host: each point is pushed
+    to the processor's event queue at its offset within the block, and the
+    parameter itself catches up with it between callbacks.
+    A state round-trip runs between blocks, as a host saving and restoring
+    mid-playback would: getStateInformation, setStateInformation with the
+    same data, then getStateInformation again to check nothing moved.
+
+    Every run records the output, the wall time of each processBlock call
+    against its deadline, and the heap allocations made inside it. Linking
+    this file replaces the allocation functions for the whole program (see
+    TestHost.cpp), so only link it into harness targets.
+*/
+class TestHost
+{
+public:
+    struct Settings
+    {
+        double sampleRate = 48000.0;
+        int maxBlockSize = 1024;            // what prepareToPlay is told; no scripted block may exceed it
+    };
+
+    struct Automation
+    {
+        juce::int64 position;
+        int parameterIndex;
+        float normalisedValue;
+    };
+
+    struct Script
+    {
+        std::vector<int> blockSizes { 512 };        // cycled until the input runs out
+        std::vector<Automation> automation;         // in any order
+        std::vector<juce::int64> stateRoundTrips;   // each runs before the block containing it
+
+        /** Adds numPoints evenly spaced points moving a parameter from one value to another. */
+        void addRamp (int parameterIndex, juce::int64 start, juce::int64 end, float from, float to, int numPoints);
+    };
+
+    /** A fixed run of block sizes drawn uniformly from minSize..maxSize, reproducible from the seed. */
+    static std::vector<int> makeRandomBlockSizes (int count, int minSize, int maxSize, juce::int64 seed);
+
+    struct BlockRecord
+    {
+        juce::int64 position;
+        int numSamples;
+        double seconds;
+        int allocations;                    // -1 where allocations aren't counted
+    };
+
+    struct RoundTripRecord
+    {
+        juce::int64 position;
+        size_t stateBytes;
+        bool stateMatched;
+        double seconds;
+    };
+
+    struct Run
+    {
+        juce::AudioBuffer<float> output;
+        std::vector<BlockRecord> blocks;
+        std::vector<RoundTripRecord> roundTrips;
+
+        int getTotalAllocations() const noexcept;
+        bool allRoundTripsMatched() const noexcept;
+
+        /** The slowest block's processing time as a fraction of its duration. */
+        double getWorstDeadlineRatio (double sampleRate) const noexcept;
+        double getRealtime (double sampleRate) const noexcept;
+    };
+
+    explicit TestHost (Settings);
+    ~TestHost();
+
+    /** Set up the starting parameters here before run(). */
+    JarEQAudioProcessor& getProcessor() noexcept        { return *processor; }
+
+    /** Prepares the processor, plays the stereo input through it as the script
+        says, and releases it again. The processor keeps its parameters between
+        runs, so use a fresh TestHost to repeat a run from the same start.
+    */
+    Run run (const juce::AudioBuffer<float>& input, const Script&);
+
+    /** False on platforms where the allocation counter can't be installed. */
+    static bool isCountingAllocations() noexcept;
+
+private:
+    Settings settings;
+    std::unique_ptr<JarEQAudioProcessor> processor;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TestHost)
+};
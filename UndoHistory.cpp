@@ -0,0 +1,213 @@
+/*
+  ==============================================================================
+
+    UndoHistory.cpp
+    Created: 19 Oct 2026 9:52:44am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#include "UndoHistory.h"
+
+//==============================================================================
+UndoHistory::UndoHistory (juce::AudioProcessor& p, std::atomic<juce::uint32>& parameterGeneration)
+    : processor (p), batch (p, parameterGeneration)
+{
+}
+
+UndoHistory::~UndoHistory()
+{
+    cancelPendingUpdate();
+
+    if (attached)
+        for (auto* parameter : processor.getParameters())
+            parameter->removeListener (this);
+}
+
+void UndoHistory::attach()
+{
+    jassert (! attached);
+
+    for (auto* parameter : processor.getParameters())
+        parameter->addListener (this);
+
+    attached = true;
+    clear();
+}
+
+//==============================================================================
+void UndoHistory::checkpoint()
+{
+    cancelPendingUpdate();
+
+    if (history.empty())
+    {
+        clear();
+        return;
+    }
+
+    Snapshot snapshot;
+    size_t bytes = 0;
+
+    if (! capture (&history[(size_t) position], snapshot, bytes))
+        return;
+
+    // A new edit after some undos replaces the redo branch
+    while (canRedo())
+        dropNewest();
+
+    pushSnapshot (std::move (snapshot), bytes);
+    enforceMemoryLimit();
+}
+
+void UndoHistory::clear()
+{
+    history.clear();
+    memoryUsage = 0;
+    position = -1;
+
+    Snapshot snapshot;
+    size_t bytes = 0;
+    capture (nullptr, snapshot, bytes);
+    pushSnapshot (std::move (snapshot), bytes);
+}
+
+bool UndoHistory::undo()
+{
+    // Anything edited since the last transaction becomes undoable first
+    checkpoint();
+
+    if (! canUndo())
+        return false;
+
+    applySnapshot (history[(size_t) --position]);
+    return true;
+}
+
+bool UndoHistory::redo()
+{
+    if (! canRedo())
+        return false;
+
+    applySnapshot (history[(size_t) ++position]);
+    return true;
+}
+
+void UndoHistory::setMemoryLimit (size_t bytes)
+{
+    memoryLimit = bytes;
+    enforceMemoryLimit();
+}
+
+//==============================================================================
+void UndoHistory::parameterGestureChanged (int, bool gestureIsStarting)
+{
+    // May arrive on any thread; the transaction is recorded on the message thread
+    // once every open gesture has ended, so a whole drag is one undo step
+    if (gestureIsStarting)
+        ++openGestures;
+    else if (--openGestures <= 0)
+    {
+        openGestures = 0;
+        triggerAsyncUpdate();
+    }
+}
+
+void UndoHistory::handleAsyncUpdate()
+{
+    if (openGestures.load() == 0)
+        checkpoint();
+}
+
+//==============================================================================
+bool UndoHistory::capture (const Snapshot* base, Snapshot& result, size_t& newBytes) const
+{
+    const auto& parameters = processor.getParameters();
+    const auto numPages = (parameters.size() + pageSize - 1) / pageSize;
+    bool changed = base == nullptr || (int) base->pages.size() != numPages;
+
+    result.pages.resize ((size_t) numPages);
+    newBytes = sizeof (Snapshot) + (size_t) numPages * sizeof (std::shared_ptr<const Page>);
+
+    for (int pageIndex = 0; pageIndex < numPages; ++pageIndex)
+    {
+        Page values {};
+
+        for (int i = 0; i < pageSize; ++i)
+            if (auto index = pageIndex * pageSize + i; index < parameters.size())
+                values[(size_t) i] = parameters.getUnchecked (index)->getValue();
+
+        const bool canShare = base != nullptr && pageIndex < (int) base->pages.size()
+                               && *base->pages[(size_t) pageIndex] == values;
+
+        if (canShare)
+        {
+            result.pages[(size_t) pageIndex] = base->pages[(size_t) pageIndex];
+        }
+        else
+        {
+            result.pages[(size_t) pageIndex] = std::make_shared<const Page> (values);
+            newBytes += sizeof (Page);
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+void UndoHistory::applySnapshot (const Snapshot& snapshot)
+{
+    const auto& parameters = processor.getParameters();
+
+    for (int index = 0; index < parameters.size(); ++index)
+    {
+        auto value = (*snapshot.pages[(size_t) (index / pageSize)])[(size_t) (index % pageSize)];
+        auto* parameter = parameters.getUnchecked (index);
+
+        if (parameter->getValue() != value)
+            batch.stageNormalised (parameter, value);
+    }
+
+    batch.apply();
+}
+
+//==============================================================================
+void UndoHistory::pushSnapshot (Snapshot&& snapshot, size_t bytes)
+{
+    history.push_back (std::move (snapshot));
+    position = (int) history.size() - 1;
+    memoryUsage += bytes;
+}
+
+size_t UndoHistory::getUniqueBytes (const Snapshot& snapshot) const
+{
+    // Pages still shared with a neighbour stay alive when this entry goes
+    auto bytes = sizeof (Snapshot) + snapshot.pages.size() * sizeof (std::shared_ptr<const Page>);
+
+    for (auto& page : snapshot.pages)
+        if (page.use_count() == 1)
+            bytes += sizeof (Page);
+
+    return bytes;
+}
+
+void UndoHistory::dropNewest()
+{
+    memoryUsage -= juce::jmin (memoryUsage, getUniqueBytes (history.back()));
+    history.pop_back();
+}
+
+void UndoHistory::dropOldest()
+{
+    memoryUsage -= juce::jmin (memoryUsage, getUniqueBytes (history.front()));
+    history.pop_front();
+    --position;
+}
+
+void UndoHistory::enforceMemoryLimit()
+{
+    // Always keep the current entry, even if it alone is over the limit
+    while (memoryUsage > memoryLimit && position > 0)
+        dropOldest();
+}
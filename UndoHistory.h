@@ -0,0 +1,94 @@
+/*
+  ==============================================================================
+
+    UndoHistory.h
+    Created: 19 Oct 2026 9:52:44am
+    Author:  jarre
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "ParameterBatch.h"
+
+//==============================================================================
+/**
+    Undo/redo for parameter edits.
+
+    Each history entry is a snapshot of every parameter's normalised value,
+    split into fixed-size pages. A new entry copies only the pages that
+    changed and shares the rest with the entry before it, so a single
+    slider edit costs one page rather than a full copy of the state.
+
+    Edits are grouped by gesture: everything between the first gesture
+    starting and the last one ending becomes one transaction, so a slider
+    drag is a single undo step. Changes made outside a gesture are folded
+    into the next transaction. Once the history uses more than its memory
+    limit, the oldest entries are dropped. Undo and redo are applied as a
+    ParameterBatch.
+*/
+class UndoHistory  : private juce::AudioProcessorParameter::Listener,
+                     private juce::AsyncUpdater
+{
+public:
+    UndoHistory (juce::AudioProcessor&, std::atomic<juce::uint32>& parameterGeneration);
+    ~UndoHistory() override;
+
+    /** Starts listening and records the current state as the base of the history.
+        Call once every parameter has been added to the processor.
+    */
+    void attach();
+
+    /** Records the current state as a transaction now, e.g. after loading a preset. */
+    void checkpoint();
+
+    /** Drops the whole history and starts again from the current state. */
+    void clear();
+
+    bool canUndo() const noexcept               { return position > 0; }
+    bool canRedo() const noexcept               { return position + 1 < (int) history.size(); }
+
+    bool undo();
+    bool redo();
+
+    void setMemoryLimit (size_t bytes);
+    size_t getMemoryUsage() const noexcept      { return memoryUsage; }
+    int getNumEntries() const noexcept          { return (int) history.size(); }
+
+private:
+    static constexpr int pageSize = 16;
+    using Page = std::array<float, pageSize>;
+
+    struct Snapshot
+    {
+        std::vector<std::shared_ptr<const Page>> pages;
+    };
+
+    void parameterValueChanged (int, float) override {}
+    void parameterGestureChanged (int parameterIndex, bool gestureIsStarting) override;
+    void handleAsyncUpdate() override;
+
+    /** Captures the current values, sharing unchanged pages with base. Returns false if nothing changed. */
+    bool capture (const Snapshot* base, Snapshot& result, size_t& newBytes) const;
+    void applySnapshot (const Snapshot&);
+
+    void pushSnapshot (Snapshot&&, size_t bytes);
+    void dropNewest();
+    void dropOldest();
+    size_t getUniqueBytes (const Snapshot&) const;
+    void enforceMemoryLimit();
+
+    juce::AudioProcessor& processor;
+    ParameterBatch batch;
+
+    std::deque<Snapshot> history;
+    int position = -1;
+    size_t memoryUsage = 0, memoryLimit = 256 * 1024;
+
+    std::atomic<int> openGestures { 0 };
+    bool attached = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (UndoHistory)
+};